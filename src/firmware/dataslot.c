@@ -298,3 +298,54 @@ int dataslot_get_size(uint16_t slot_id, uint32_t *size_out) {
     }
     return 0;
 }
+
+/* ============================================
+ * D-cache maintenance
+ * ============================================ */
+
+#if DCACHE_CBO
+#define CBO_RANGE(op, addr, length) do {                                    \
+        uint32_t a = (uint32_t)(addr) & ~(uint32_t)(DCACHE_LINE - 1);       \
+        uint32_t e = (uint32_t)(addr) + (length);                           \
+        for (; a < e; a += DCACHE_LINE)                                     \
+            __asm__ volatile(".insn i 0x0F, 2, x0, %0, " #op                \
+                             :: "r"(a) : "memory");                         \
+    } while (0)
+#endif
+
+static inline void dcache_flush_all(void) {
+    __asm__ volatile("fence" ::: "memory");
+    __asm__ volatile(".word 0x0000100f" ::: "memory");  /* fence.i */
+}
+
+/* Write dirty lines back to SDRAM, e.g. before the bridge reads them */
+void dcache_clean_range(const void *addr, uint32_t length) {
+#if DCACHE_CBO
+    CBO_RANGE(1, addr, length);         /* cbo.clean */
+    __asm__ volatile("fence" ::: "memory");
+#else
+    (void)addr; (void)length;
+    dcache_flush_all();
+#endif
+}
+
+/* Drop lines so the next load refills from SDRAM, e.g. after a DMA write */
+void dcache_inval_range(const void *addr, uint32_t length) {
+#if DCACHE_CBO
+    __asm__ volatile("fence" ::: "memory");
+    CBO_RANGE(0, addr, length);         /* cbo.inval */
+#else
+    (void)addr; (void)length;
+    dcache_flush_all();
+#endif
+}
+
+const void *dma_read_view(uint32_t addr, uint32_t length) {
+    if (DCACHE_CBO || length >= DCACHE_FLUSH_MIN) {
+        dcache_inval_range((const void *)addr, length);
+        return (const void *)addr;
+    }
+    /* Keeps the caller's loads after the DMA completion under LTO */
+    __asm__ volatile("" ::: "memory");
+    return SDRAM_UNCACHED(addr);
+}
@@ -57,14 +57,47 @@
 #define SDRAM_UNCACHED(addr) ((void *)((uint32_t)(addr) + 0x40000000))
 
 /* Shared DMA bounce buffer for dataslot_read callers.
- * After DMA, data must be read through SDRAM_UNCACHED(DMA_BUFFER) to
- * bypass stale D-cache lines, then memcpy'd to the final destination. */
+ * After DMA, data must be read through dma_read_view(DMA_BUFFER, len) (or
+ * SDRAM_UNCACHED directly) to avoid stale D-cache lines, then memcpy'd to
+ * the final destination.  Never store to it through the cached alias: a
+ * dirty line written back later would land on top of DMA'd data. */
 #define DMA_BUFFER       0x13F00000          /* Fixed SDRAM address for DMA */
 /* Bridge writes are buffered through a 512-deep dcfifo plus 4-deep skid
  * queue, so moderate chunks are safe.  Each DMA round-trip has overhead
  * from the 1023-cycle done-quiet window, so larger chunks = fewer trips. */
 #define DMA_CHUNK_SIZE   (32 * 1024)         /* Max bytes per DMA transfer */
 
+/*
+ * D-cache maintenance
+ *
+ * With DCACHE_CBO=1 (a core generated with Zicbom) single 64-byte lines
+ * are cleaned or invalidated by address.  Without it the only tool is
+ * fence.i, which writes back and invalidates the entire D-cache, so the
+ * range calls fall back to that and dma_read_view() only takes the cached
+ * path for transfers big enough to pay for the lost cache contents.
+ *
+ * The shipped core is built without it.  The last recorded fit of that
+ * core (fpga/vexii_sweep_results.csv, seed 19) uses 88% of ALMs and
+ * 297/308 M10K at -1.3 ns setup slack, and the scanout blend since took
+ * two of the eleven free M10K.  Per-line ops widen the LSU L1 control
+ * path, so a Zicbom core has to close timing in that fit first.
+ */
+#ifndef DCACHE_CBO
+#define DCACHE_CBO          0
+#endif
+#define DCACHE_LINE         64
+#define DCACHE_FLUSH_MIN    (32 * 1024)     /* smallest read worth a full flush */
+
+void dcache_clean_range(const void *addr, uint32_t length);
+void dcache_inval_range(const void *addr, uint32_t length);
+
+/*
+ * Pointer to read length bytes of freshly DMA'd SDRAM at addr: the cached
+ * address after invalidating it when that is cheap enough, else the
+ * uncached alias.  Either way the data may then be memcpy'd normally.
+ */
+const void *dma_read_view(uint32_t addr, uint32_t length);
+
 /* Open file parameter structure (256 + 4 + 4 = 264 bytes) */
 typedef struct __attribute__((packed)) {
     char     filename[256];   /* Null-terminated path */
@@ -20,6 +20,12 @@ FILE *stderr = &stderr_file;
 static FILE file_table[MAX_OPEN_FILES];
 static int file_table_used[MAX_OPEN_FILES] = {0};
 
+/* Read buffers for PAK streams.  Small freads (demo messages, script
+ * parsing) are served from a window filled by one bridge read instead of a
+ * round trip each; fseek inside the window keeps it. */
+#define FILE_BUF_SIZE  (16 * 1024)
+static uint8_t file_bufs[MAX_OPEN_FILES][FILE_BUF_SIZE];
+
 /* Find a free file slot */
 static FILE *alloc_file(void) {
     for (int i = 0; i < MAX_OPEN_FILES; i++) {
@@ -170,7 +176,7 @@ static uint32_t sav_read_from_sdram(int slot_num) {
         return 0;
 
     memset(sav_buf, 0, SAV_BUF_SIZE);
-    volatile uint32_t *wsrc = (volatile uint32_t *)SDRAM_UNCACHED(slot_addr + SAV_HEADER_SIZE);
+    const uint32_t *wsrc = (const uint32_t *)dma_read_view(slot_addr + SAV_HEADER_SIZE, saved_size);
     uint32_t *wdst = (uint32_t *)sav_buf;
     uint32_t words = saved_size >> 2;
     for (uint32_t i = 0; i < words; i++)
@@ -271,6 +277,7 @@ FILE *fopen(const char *pathname, const char *mode) {
     f->flags = 0;
     f->data = NULL;
     f->size = PAK_MAX_SIZE;
+    f->buf = file_bufs[f - file_table];
 
     return f;
 }
@@ -348,16 +355,45 @@ size_t fread(void *ptr, size_t size, size_t nmemb, FILE *stream) {
         return nmemb;
     }
 
-    /* DMA to bounce buffer, then copy via uncacheable alias to avoid
-     * stale D-cache lines at the destination address. */
     uint8_t *dest = (uint8_t *)ptr;
     size_t remaining = total_bytes;
     while (remaining > 0) {
+        /* Whatever the buffered window already holds */
+        if (stream->offset >= stream->buf_start &&
+            stream->offset - stream->buf_start < stream->buf_len) {
+            size_t n = stream->buf_start + stream->buf_len - stream->offset;
+            if (n > remaining)
+                n = remaining;
+            memcpy(dest, stream->buf + (stream->offset - stream->buf_start), n);
+            dest += n;
+            stream->offset += n;
+            remaining -= n;
+            continue;
+        }
+
+        /* Refill the window for small reads.  size is only the slot's
+         * upper bound, so near the real end of the PAK the read-ahead can
+         * fail; the exact read below still works there. */
+        if (stream->buf && remaining < FILE_BUF_SIZE) {
+            size_t fill = FILE_BUF_SIZE;
+            if (fill > stream->size - stream->offset)
+                fill = stream->size - stream->offset;
+            if (dataslot_read(stream->slot_id, stream->offset, (void *)DMA_BUFFER, fill) == 0) {
+                memcpy(stream->buf, dma_read_view(DMA_BUFFER, fill), fill);
+                stream->buf_start = stream->offset;
+                stream->buf_len = fill;
+                continue;
+            }
+            stream->buf_len = 0;
+        }
+
+        /* DMA to bounce buffer, then copy out through dma_read_view so
+         * stale D-cache lines for the buffer are never read. */
         size_t chunk = remaining > DMA_CHUNK_SIZE ? DMA_CHUNK_SIZE : remaining;
         if (dataslot_read(stream->slot_id, stream->offset, (void *)DMA_BUFFER, chunk) != 0) {
-            return 0;
+            return (total_bytes - remaining) / size;
         }
-        memcpy(dest, SDRAM_UNCACHED(DMA_BUFFER), chunk);
+        memcpy(dest, dma_read_view(DMA_BUFFER, chunk), chunk);
         dest += chunk;
         stream->offset += chunk;
         remaining -= chunk;
@@ -818,7 +854,7 @@ ssize_t read(int fd, void *buf, size_t count) {
         return 0;
     }
 
-    /* DMA to bounce buffer, copy via uncacheable alias */
+    /* DMA to bounce buffer, copy out through dma_read_view */
     uint8_t *dest = (uint8_t *)buf;
     size_t remaining = count;
     uint32_t off = fd_offset[slot_id];
@@ -827,7 +863,7 @@ ssize_t read(int fd, void *buf, size_t count) {
         if (dataslot_read(slot_id, off, (void *)DMA_BUFFER, chunk) != 0) {
             return -1;
         }
-        memcpy(dest, SDRAM_UNCACHED(DMA_BUFFER), chunk);
+        memcpy(dest, dma_read_view(DMA_BUFFER, chunk), chunk);
         dest += chunk;
         off += chunk;
         remaining -= chunk;
@@ -983,8 +1019,8 @@ void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
         return MAP_FAILED;
     }
 
-    /* DMA to bounce buffer in chunks, copy via uncacheable alias to
-     * avoid stale D-cache lines at the malloc'd destination. */
+    /* DMA to bounce buffer in chunks, copy out through dma_read_view
+     * to avoid stale D-cache lines for the buffer. */
     uint8_t *dest = (uint8_t *)ptr;
     size_t remaining = length;
     uint32_t slot_off = (uint32_t)offset;
@@ -994,7 +1030,7 @@ void *mmap(void *addr, size_t length, int prot, int flags, int fd, off_t offset)
             free(ptr);
             return MAP_FAILED;
         }
-        memcpy(dest, SDRAM_UNCACHED(DMA_BUFFER), chunk);
+        memcpy(dest, dma_read_view(DMA_BUFFER, chunk), chunk);
         dest += chunk;
         slot_off += chunk;
         remaining -= chunk;
@@ -31,6 +31,10 @@
 #define SYS_PERF_SDRAM_CPU  (*(volatile uint32_t*)(SYSREG_BASE + 0x8C))
 #define SYS_PERF_SPAN_FIFO_FULL (*(volatile uint32_t*)(SYSREG_BASE + 0x98))
 #define SYS_PERF_CPU_CONTENTION (*(volatile uint32_t*)(SYSREG_BASE + 0x9C))
+#define SYS_PERF_ICACHE_MISS  (*(volatile uint32_t*)(SYSREG_BASE + 0xC8))
+#define SYS_PERF_DCACHE_MISS  (*(volatile uint32_t*)(SYSREG_BASE + 0xCC))
+#define SYS_PERF_ICACHE_STALL (*(volatile uint32_t*)(SYSREG_BASE + 0xD0))
+#define SYS_PERF_DCACHE_STALL (*(volatile uint32_t*)(SYSREG_BASE + 0xD4))
 
 /* Span rasterizer performance counters (write-clear via SPAN_PERF_CACHE_HITS) */
 #define SPAN_PERF_CACHE_HITS   (*(volatile uint32_t*)0x4800005C)
@@ -208,6 +212,9 @@ typedef struct {
     uint32_t size;
     uint32_t flags;
     void *data;         /* Pointer to loaded data in SDRAM */
+    uint8_t *buf;       /* Read buffer for slot-backed streams */
+    uint32_t buf_start; /* File offset of buf[0] */
+    uint32_t buf_len;   /* Valid bytes in buf */
 } FILE;
 
 extern FILE *stdin;
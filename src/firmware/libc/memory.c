@@ -4,6 +4,8 @@
  */
 
 #include "libc.h"
+#include "../dataslot.h"
+#include "../quake/dma_accel.h"
 
 /* ============================================
  * Heap allocator
@@ -191,24 +193,89 @@ void *realloc(void *ptr, size_t size) {
 
 /* ============================================
  * Memory operations
+ *
+ * Misaligned word accesses trap to the emulation handler, so everything
+ * below aligns the destination first and never issues one: a source at a
+ * different alignment is read as aligned words and shifted together.  The
+ * aligned bodies move a whole 64-byte D-cache line per iteration.
  * ============================================ */
 
+#define LINE_BYTES  64
+
+/* Large SDRAM fills go to the DMA fill engine, which writes 64-byte bursts.
+ * Without Zicbom the D-cache has to be flushed whole first, so the
+ * break-even point is much higher.  memset_dma_min is a variable so the
+ * membench console command can move it. */
+#if DCACHE_CBO
+#define MEMSET_DMA_MIN  (4 * 1024)
+#else
+#define MEMSET_DMA_MIN  (64 * 1024)
+#endif
+
+size_t memset_dma_min = MEMSET_DMA_MIN;
+
+#define IN_SDRAM(p, n)  ((uintptr_t)(p) >= 0x10000000 && \
+                         (uintptr_t)(p) + (n) <= 0x14000000)
+
+static void copy_words(uint32_t *d, const uint32_t *s, size_t words) {
+    while (words >= LINE_BYTES / 4) {
+        uint32_t t0 = s[0], t1 = s[1], t2 = s[2], t3 = s[3];
+        uint32_t t4 = s[4], t5 = s[5], t6 = s[6], t7 = s[7];
+        d[0] = t0; d[1] = t1; d[2] = t2; d[3] = t3;
+        d[4] = t4; d[5] = t5; d[6] = t6; d[7] = t7;
+        t0 = s[8]; t1 = s[9]; t2 = s[10]; t3 = s[11];
+        t4 = s[12]; t5 = s[13]; t6 = s[14]; t7 = s[15];
+        d[8] = t0; d[9] = t1; d[10] = t2; d[11] = t3;
+        d[12] = t4; d[13] = t5; d[14] = t6; d[15] = t7;
+        d += LINE_BYTES / 4;
+        s += LINE_BYTES / 4;
+        words -= LINE_BYTES / 4;
+    }
+    while (words--)
+        *d++ = *s++;
+}
+
+/* d is word aligned, s is not: sh = (s & 3) * 8 is 8, 16 or 24 */
+static void copy_words_shifted(uint32_t *restrict d, const uint8_t *s, size_t words) {
+    const uint32_t *s32 = (const uint32_t *)((uintptr_t)s & ~3);
+    unsigned sh = ((uintptr_t)s & 3) * 8;
+    uint32_t w0 = *s32++, w1, w2;
+
+    while (words >= 2) {
+        w1 = s32[0];
+        w2 = s32[1];
+        d[0] = (w0 >> sh) | (w1 << (32 - sh));
+        d[1] = (w1 >> sh) | (w2 << (32 - sh));
+        w0 = w2;
+        s32 += 2;
+        d += 2;
+        words -= 2;
+    }
+    if (words) {
+        w1 = *s32;
+        *d = (w0 >> sh) | (w1 << (32 - sh));
+    }
+}
+
 void *memcpy(void *dest, const void *src, size_t n) {
     uint8_t *d = (uint8_t *)dest;
     const uint8_t *s = (const uint8_t *)src;
 
-    /* Word-aligned copy for better performance */
-    if (((uintptr_t)d & 3) == 0 && ((uintptr_t)s & 3) == 0) {
-        uint32_t *d32 = (uint32_t *)d;
-        const uint32_t *s32 = (const uint32_t *)s;
-
-        while (n >= 4) {
-            *d32++ = *s32++;
-            n -= 4;
+    if (n >= 8) {
+        /* Align the destination */
+        while ((uintptr_t)d & 3) {
+            *d++ = *s++;
+            n--;
         }
 
-        d = (uint8_t *)d32;
-        s = (const uint8_t *)s32;
+        size_t words = n >> 2;
+        if (((uintptr_t)s & 3) == 0)
+            copy_words((uint32_t *)d, (const uint32_t *)s, words);
+        else
+            copy_words_shifted((uint32_t *)d, s, words);
+        d += words << 2;
+        s += words << 2;
+        n &= 3;
     }
 
     /* Copy remaining bytes */
@@ -220,20 +287,62 @@ void *memcpy(void *dest, const void *src, size_t n) {
     return dest;
 }
 
+/*
+ * Hand the line-aligned middle of a big SDRAM fill to the DMA engine.
+ * Dropping the lines before the fill keeps a later writeback of stale dirty
+ * data from landing on top of it.  Returns the bytes done, or 0 to leave
+ * the whole fill to the CPU.
+ */
+static size_t memset_dma(uint8_t *p, uint32_t val32, size_t n) {
+    uintptr_t start = ((uintptr_t)p + LINE_BYTES - 1) & ~(uintptr_t)(LINE_BYTES - 1);
+    uintptr_t end = ((uintptr_t)p + n) & ~(uintptr_t)(LINE_BYTES - 1);
+
+    if (n < memset_dma_min || !IN_SDRAM(p, n) || end <= start || dma_busy())
+        return 0;
+
+    dcache_inval_range((const void *)start, end - start);
+    dma_fill(start, end - start, val32);
+    while (dma_busy())
+        ;
+    return end - start;
+}
+
 void *memset(void *s, int c, size_t n) {
     uint8_t *p = (uint8_t *)s;
     uint8_t val = (uint8_t)c;
+    uint32_t val32 = val * 0x01010101u;
+
+    if (n >= 8) {
+        size_t done = memset_dma(p, val32, n);
+        if (done) {
+            /* The engine did the aligned middle, fill the ragged ends */
+            uint8_t *mid = (uint8_t *)(((uintptr_t)p + LINE_BYTES - 1) & ~(uintptr_t)(LINE_BYTES - 1));
+            uint8_t *e = p + n;
+            while (p < mid)
+                *p++ = val;
+            for (p = mid + done; p < e; p++)
+                *p = val;
+            return s;
+        }
 
-    /* Word-aligned fill for better performance */
-    if (((uintptr_t)p & 3) == 0) {
-        uint32_t val32 = val | (val << 8) | (val << 16) | (val << 24);
+        /* Align, then whole lines, then words */
+        while ((uintptr_t)p & 3) {
+            *p++ = val;
+            n--;
+        }
         uint32_t *p32 = (uint32_t *)p;
-
+        while (n >= LINE_BYTES) {
+            p32[0] = val32; p32[1] = val32; p32[2] = val32; p32[3] = val32;
+            p32[4] = val32; p32[5] = val32; p32[6] = val32; p32[7] = val32;
+            p32[8] = val32; p32[9] = val32; p32[10] = val32; p32[11] = val32;
+            p32[12] = val32; p32[13] = val32; p32[14] = val32; p32[15] = val32;
+            p32 += LINE_BYTES / 4;
+            n -= LINE_BYTES;
+        }
         while (n >= 4) {
             *p32++ = val32;
             n -= 4;
         }
-
         p = (uint8_t *)p32;
     }
 
@@ -254,8 +363,8 @@ void *memmove(void *dest, const void *src, size_t n) {
         return dest;
     }
 
-    /* If dest is before src, copy forward */
-    if (d < s) {
+    /* If dest is before src, or they don't overlap, copy forward */
+    if (d < s || d >= s + n) {
         return memcpy(dest, src, n);
     }
 
@@ -263,6 +372,22 @@ void *memmove(void *dest, const void *src, size_t n) {
     d += n;
     s += n;
 
+    /* Word steps when both ends line up; the gap is at least 4 bytes then */
+    if ((((uintptr_t)d ^ (uintptr_t)s) & 3) == 0 && n >= 8) {
+        while ((uintptr_t)d & 3) {
+            *--d = *--s;
+            n--;
+        }
+        uint32_t *d32 = (uint32_t *)d;
+        const uint32_t *s32 = (const uint32_t *)s;
+        while (n >= 4) {
+            *--d32 = *--s32;
+            n -= 4;
+        }
+        d = (uint8_t *)d32;
+        s = (const uint8_t *)s32;
+    }
+
     while (n > 0) {
         *--d = *--s;
         n--;
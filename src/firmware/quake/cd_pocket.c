@@ -1,9 +1,9 @@
 /*
  * cd_pocket.c -- CD audio streaming for PocketQuake (HW resampler)
  *
- * Bridge DMA loads CD audio into SDRAM, CPU reads via uncached alias
- * (zero D-cache pollution) and pushes raw samples to HW resampler FIFO.
- * Timer ISR feeds the FIFO at 200 Hz for glitch-free playback at any FPS.
+ * Bridge DMA lands CD audio straight in an SDRAM ring and the HW
+ * resampler fetches it from there with its own read master; the CPU never
+ * touches the samples, it only queues chunks and moves RING_WRITE_POS.
  *
  * The HW resampler handles 44100→48000 Hz resampling, volume, and mixing.
  *
@@ -17,24 +17,28 @@
 #define TRACK_MIN  2
 #define TRACK_MAX  11
 
-/* Ring buffer in SDRAM — accessed ONLY through uncached alias.
- * 16384 stereo frames = 64KB, power-of-two. */
+/* Ring buffer in SDRAM — written only by bridge DMA, read only by the
+ * resampler.  16384 stereo frames = 64KB, power-of-two, placed past
+ * the 32KB DMA_BUFFER so other file reads cannot land on it.  Chunks are
+ * a quarter of the ring and always start chunk-aligned, so a chunk never
+ * wraps and can be DMA'd in place. */
 #define MUSIC_BUF_FRAMES   16384
 #define MUSIC_BUF_MASK     (MUSIC_BUF_FRAMES - 1)
-#define MUSIC_BUF_ADDR     0x13F00000
-#define MUSIC_BUF_UC       ((volatile unsigned int *)SDRAM_UNCACHED(MUSIC_BUF_ADDR))
+#define MUSIC_BUF_ADDR     0x13F10000
 
 #define MUSIC_DMA_CHUNK    (16 * 1024)
 
 /* HW resampler MMIO */
 #define MUSIC_CTRL       (*(volatile unsigned int *)0x4C000008)
 #define MUSIC_VOLUME     (*(volatile unsigned int *)0x4C00000C)
-#define MUSIC_FIFO_LEVEL (*(volatile unsigned int *)0x4C000014)
-#define MUSIC_DATA       (*(volatile unsigned int *)0x4C00001C)
+#define MUSIC_RING_BASE  (*(volatile unsigned int *)0x4C000028)
+#define MUSIC_RING_MASK  (*(volatile unsigned int *)0x4C00002C)
+#define MUSIC_RING_WPOS  (*(volatile unsigned int *)0x4C000030)
+#define MUSIC_RING_RPOS  (*(volatile unsigned int *)0x4C000034)
 
 #define MUSIC_CTRL_ENABLE  (1 << 0)
 #define MUSIC_CTRL_PAUSE   (1 << 1)
-#define HW_FIFO_DEPTH      512
+#define MUSIC_CTRL_RING    (1 << 2)
 
 static int  cd_playing;
 static int  cd_looping;
@@ -42,9 +46,8 @@ static byte cd_track;
 static int  cd_slot_id;
 static unsigned int cd_file_offset;
 
-/* Ring buffer positions (monotonically increasing frame counts) */
-static volatile unsigned int music_write_pos;
-static volatile unsigned int music_read_pos;
+/* Frames landed in the ring (monotonic); the read side is MUSIC_RING_RPOS */
+static unsigned int music_write_pos;
 
 static int cd_available;
 static int cd_dma_pending;
@@ -52,6 +55,12 @@ static unsigned int cd_dma_frames;
 
 static int CDAudio_StartChunk(void);
 
+/* Ring slot the next chunk is DMA'd into */
+static inline void *CDAudio_ChunkDest(void)
+{
+    return (void *)(uintptr_t)(MUSIC_BUF_ADDR + (music_write_pos & MUSIC_BUF_MASK) * 4);
+}
+
 void CDAudio_DataslotYield(void)
 {
     if (!cd_dma_pending)
@@ -64,12 +73,9 @@ void CDAudio_DataslotYield(void)
     cd_dma_pending = 0;
 
     if (rc > 0) {
-        volatile unsigned int *src = (volatile unsigned int *)SDRAM_UNCACHED(DMA_BUFFER);
-        unsigned int wp = music_write_pos;
-        for (unsigned int i = 0; i < cd_dma_frames; i++)
-            MUSIC_BUF_UC[(wp + i) & MUSIC_BUF_MASK] = src[i];
-        music_write_pos = wp + cd_dma_frames;
+        music_write_pos += cd_dma_frames;
         cd_file_offset += cd_dma_frames * 4;
+        MUSIC_RING_WPOS = music_write_pos;
     } else if (rc < 0) {
         if (cd_looping)
             cd_file_offset = 0;
@@ -84,37 +90,14 @@ static int CDAudio_Probe(void)
     return (rc >= 0) ? 1 : 0;
 }
 
-/*
- * Push frames from uncached SDRAM ring to HW resampler FIFO.
- * Called from timer ISR (200 Hz) and SNDDMA_FillRing.
- * Uncached SDRAM reads: zero D-cache pollution, ~0.26% bus time.
- */
-void CDAudio_CopyToHW(void)
-{
-    if (!cd_playing)
-        return;
-
-    unsigned int avail = music_write_pos - music_read_pos;
-    unsigned int hw_space = HW_FIFO_DEPTH - (MUSIC_FIFO_LEVEL & 0x3FF);
-
-    unsigned int count = avail < hw_space ? avail : hw_space;
-    if (count > 128)
-        count = 128;
-
-    unsigned int rp = music_read_pos;
-    for (unsigned int i = 0; i < count; i++)
-        MUSIC_DATA = MUSIC_BUF_UC[(rp + i) & MUSIC_BUF_MASK];
-    music_read_pos = rp + count;
-}
-
 static int CDAudio_StartChunk(void)
 {
-    if (music_write_pos - music_read_pos >= MUSIC_BUF_FRAMES - MUSIC_DMA_CHUNK / 4)
+    if (music_write_pos - MUSIC_RING_RPOS >= MUSIC_BUF_FRAMES - MUSIC_DMA_CHUNK / 4)
         return -1;
 
     cd_dma_frames = MUSIC_DMA_CHUNK / 4;
     dataslot_read_start(cd_slot_id, cd_file_offset,
-                        (void *)(uintptr_t)DMA_BUFFER, MUSIC_DMA_CHUNK);
+                        CDAudio_ChunkDest(), MUSIC_DMA_CHUNK);
     cd_dma_pending = 1;
     return 0;
 }
@@ -139,12 +122,9 @@ static void CDAudio_Refill(void)
                 return;
             }
         } else {
-            volatile unsigned int *src = (volatile unsigned int *)SDRAM_UNCACHED(DMA_BUFFER);
-            unsigned int wp = music_write_pos;
-            for (unsigned int i = 0; i < cd_dma_frames; i++)
-                MUSIC_BUF_UC[(wp + i) & MUSIC_BUF_MASK] = src[i];
-            music_write_pos = wp + cd_dma_frames;
+            music_write_pos += cd_dma_frames;
             cd_file_offset += cd_dma_frames * 4;
+            MUSIC_RING_WPOS = music_write_pos;
         }
     }
 
@@ -167,11 +147,10 @@ void CDAudio_Play(byte track, qboolean looping)
     cd_looping = looping;
     cd_playing = 1;
     music_write_pos = 0;
-    music_read_pos = 0;
 
     for (int i = 0; i < 4; i++) {
         int rc = dataslot_read(cd_slot_id, cd_file_offset,
-                               (void *)(uintptr_t)DMA_BUFFER, MUSIC_DMA_CHUNK);
+                               CDAudio_ChunkDest(), MUSIC_DMA_CHUNK);
         if (rc < 0) {
             if (i == 0) {
                 Con_Printf("CD Audio: track %d not found\n", track);
@@ -180,23 +159,22 @@ void CDAudio_Play(byte track, qboolean looping)
             }
             break;
         }
-        volatile unsigned int *src = (volatile unsigned int *)SDRAM_UNCACHED(DMA_BUFFER);
-        unsigned int wp = music_write_pos;
-        for (unsigned int j = 0; j < MUSIC_DMA_CHUNK / 4; j++)
-            MUSIC_BUF_UC[(wp + j) & MUSIC_BUF_MASK] = src[j];
-        music_write_pos = wp + MUSIC_DMA_CHUNK / 4;
+        music_write_pos += MUSIC_DMA_CHUNK / 4;
         cd_file_offset += MUSIC_DMA_CHUNK;
     }
     cd_dma_pending = 0;
 
-    CDAudio_CopyToHW();
+    /* Enabling resets RING_RPOS to 0, matching music_write_pos above */
+    MUSIC_RING_BASE = MUSIC_BUF_ADDR;
+    MUSIC_RING_MASK = MUSIC_BUF_MASK;
+    MUSIC_RING_WPOS = music_write_pos;
 
     extern cvar_t bgmvolume;
     int vol = (int)(bgmvolume.value * 256);
     if (vol < 0) vol = 0;
     if (vol > 256) vol = 256;
     MUSIC_VOLUME = vol;
-    MUSIC_CTRL = MUSIC_CTRL_ENABLE;
+    MUSIC_CTRL = MUSIC_CTRL_ENABLE | MUSIC_CTRL_RING;
 }
 
 void CDAudio_Stop(void)
@@ -205,19 +183,18 @@ void CDAudio_Stop(void)
     cd_playing = 0;
     cd_dma_pending = 0;
     music_write_pos = 0;
-    music_read_pos = 0;
 }
 
 void CDAudio_Pause(void)
 {
     if (cd_playing)
-        MUSIC_CTRL = MUSIC_CTRL_ENABLE | MUSIC_CTRL_PAUSE;
+        MUSIC_CTRL = MUSIC_CTRL_ENABLE | MUSIC_CTRL_PAUSE | MUSIC_CTRL_RING;
 }
 
 void CDAudio_Resume(void)
 {
     if (cd_playing)
-        MUSIC_CTRL = MUSIC_CTRL_ENABLE;
+        MUSIC_CTRL = MUSIC_CTRL_ENABLE | MUSIC_CTRL_RING;
 }
 
 void CDAudio_Update(void)
@@ -393,6 +393,24 @@ float	CL_LerpPoint (void)
 	float	f, frac;
 
 	f = cl.mtime[0] - cl.mtime[1];
+
+	if (f && sv.active && sv_tickrate.value > 0 && !cl_nolerp.value && !cls.timedemo)
+	{	// local server on a fixed tick: draw one tick behind the newest
+		// state, advancing by the time banked towards the next tick
+		if (f > 0.1)
+		{
+			cl.mtime[1] = cl.mtime[0] - 0.1;
+			f = 0.1;
+		}
+		cl.time = cl.mtime[0] - (1 - host_tickfrac) / sv_tickrate.value;
+		frac = (cl.time - cl.mtime[1]) / f;
+		if (frac < 0)
+		{
+			cl.time = cl.mtime[1];
+			frac = 0;
+		}
+		return frac;
+	}
 	
 	if (!f || cl_nolerp.value || cls.timedemo || sv.active)
 	{
@@ -683,6 +701,7 @@ void CL_SendCmd (void)
 	
 	// send the unreliable message
 		CL_SendMove (&cmd);
+		VID_LatencyMark (LAT_SENDCMD);
 	
 	}
 
@@ -137,6 +137,9 @@ void InsertLinkAfter (link_t *l, link_t *after)
 
 void Q_memset (void *dest, int fill, int count)
 {
+#ifdef POCKET_QUAKE
+	memset (dest, fill, count);		// line-unrolled, large fills go to DMA
+#else
 	int             i;
 	
 	if ( (((long)dest | count) & 3) == 0)
@@ -149,10 +152,14 @@ void Q_memset (void *dest, int fill, int count)
 	else
 		for (i=0 ; i<count ; i++)
 			((byte *)dest)[i] = fill;
+#endif
 }
 
 void Q_memcpy (void *dest, void *src, int count)
 {
+#ifdef POCKET_QUAKE
+	memcpy (dest, src, count);		// handles misaligned input without byte loops
+#else
 	int             i;
 	
 	if (( ( (long)dest | (long)src | count) & 3) == 0 )
@@ -164,6 +171,7 @@ void Q_memcpy (void *dest, void *src, int count)
 	else
 		for (i=0 ; i<count ; i++)
 			((byte *)dest)[i] = ((byte *)src)[i];
+#endif
 }
 
 int Q_memcmp (void *m1, void *m2, int count)
@@ -1117,6 +1125,74 @@ void COM_InitArgv (int argc, char **argv)
 }
 
 
+#ifdef POCKET_QUAKE
+/*
+================
+COM_MemBench_f
+
+Average cycles per call of memcpy and memset over a matrix of sizes and
+dst/src alignments.  The last column is memset with the DMA fill engine
+held off, for tuning memset_dma_min against the set0 column.
+================
+*/
+#define MEMBENCH_MAX	(256*1024)
+
+extern size_t	memset_dma_min;
+
+static void COM_MemBench_f (void)
+{
+	static const int	sizes[] = {16, 64, 256, 1024, 4096, 16384, 65536, MEMBENCH_MAX};
+	static const int	align[4][2] = {{0,0}, {0,1}, {1,0}, {3,2}};	// dst, src
+	byte		*buf, *src, *dst;
+	int			i, j, k, n, iters;
+	unsigned	start, cyc[7];
+	size_t		dmamin;
+
+	buf = malloc (2*MEMBENCH_MAX + 256);
+	if (!buf)
+	{
+		Con_Printf ("membench: out of memory\n");
+		return;
+	}
+	src = (byte *)(((uintptr_t)buf + 63) & ~63);
+	dst = src + MEMBENCH_MAX + 64;
+	memset (src, 0x5a, MEMBENCH_MAX + 4);
+	dmamin = memset_dma_min;
+
+	Con_Printf ("  size cpy0/0 cpy0/1 cpy1/0 cpy3/2   set0   set1 setcpu\n");
+	for (i=0 ; i<sizeof(sizes)/sizeof(sizes[0]) ; i++)
+	{
+		n = sizes[i];
+		iters = (1024*1024) / n;
+		if (iters < 4)
+			iters = 4;
+
+		for (k=0 ; k<4 ; k++)
+		{
+			start = SYS_CYCLE_LO;
+			for (j=0 ; j<iters ; j++)
+				memcpy (dst + align[k][0], src + align[k][1], n);
+			cyc[k] = (SYS_CYCLE_LO - start) / iters;
+		}
+		for (k=0 ; k<3 ; k++)
+		{
+			if (k == 2)
+				memset_dma_min = ~(size_t)0;
+			start = SYS_CYCLE_LO;
+			for (j=0 ; j<iters ; j++)
+				memset (dst + (k & 1), j, n);
+			cyc[4+k] = (SYS_CYCLE_LO - start) / iters;
+		}
+		memset_dma_min = dmamin;
+
+		Con_Printf ("%6d %6u %6u %6u %6u %6u %6u %6u\n", n, cyc[0], cyc[1],
+				cyc[2], cyc[3], cyc[4], cyc[5], cyc[6]);
+	}
+
+	free (buf);
+}
+#endif
+
 /*
 ================
 COM_Init
@@ -1151,6 +1227,9 @@ void COM_Init (char *basedir)
 	Cvar_RegisterVariable (&registered);
 	Cvar_RegisterVariable (&cmdline);
 	Cmd_AddCommand ("path", COM_Path_f);
+#ifdef POCKET_QUAKE
+	Cmd_AddCommand ("membench", COM_MemBench_f);
+#endif
 
 	COM_InitFilesystem ();
 	COM_CheckRegistered ();
@@ -515,6 +515,33 @@ void Con_DrawInput (void)
 }
 
 
+/*
+================
+Con_NotifyVisible
+
+True while Con_DrawNotify has anything to draw
+================
+*/
+qboolean Con_NotifyVisible (void)
+{
+	int		i;
+	float	time;
+
+	if (key_dest == key_message)
+		return true;
+
+	for (i= con_current-NUM_CON_TIMES+1 ; i<=con_current ; i++)
+	{
+		if (i < 0)
+			continue;
+		time = con_times[i % NUM_CON_TIMES];
+		if (time && realtime - time <= con_notifytime.value)
+			return true;
+	}
+	return false;
+}
+
+
 /*
 ================
 Con_DrawNotify
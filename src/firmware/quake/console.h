@@ -39,6 +39,7 @@ void Con_DPrintf (char *fmt, ...);
 void Con_SafePrintf (char *fmt, ...);
 void Con_Clear_f (void);
 void Con_DrawNotify (void);
+qboolean Con_NotifyVisible (void);
 void Con_ClearNotify (void);
 void Con_ToggleConsole_f (void);
 
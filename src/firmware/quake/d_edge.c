@@ -181,7 +181,7 @@ PQ_FASTTEXT void D_CalcGradients (msurface_t *pface)
 D_DrawSurfaces
 ==============
 */
-PQ_FASTTEXT void D_DrawSurfaces (void)
+PQ_HOTTEXT void D_DrawSurfaces (void)
 {
 	surf_t			*s;
 	msurface_t		*pface;
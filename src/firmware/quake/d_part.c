@@ -47,48 +47,25 @@ void D_StartParticles (void)
 
 #if	!id386
 
+#define PARTICLE_BATCH	256
+
+static int		batch_u[PARTICLE_BATCH], batch_v[PARTICLE_BATCH];
+static int		batch_izi[PARTICLE_BATCH];
+static byte		batch_color[PARTICLE_BATCH];
+
 /*
 ==============
-D_DrawParticle
+D_DrawParticleSplat
 ==============
 */
-PQ_FASTTEXT void D_DrawParticle (particle_t *pparticle)
+static inline void D_DrawParticleSplat (int u, int v, int izi, byte color)
 {
-	vec3_t	local, transformed;
-	float	zi;
 	byte	*pdest;
 	short	*pz;
-	int		i, izi, pix, count, u, v;
-
-// transform point
-	VectorSubtract (pparticle->org, r_origin, local);
-
-	transformed[0] = DotProduct(local, r_pright);
-	transformed[1] = DotProduct(local, r_pup);
-	transformed[2] = DotProduct(local, r_ppn);		
-
-	if (transformed[2] < PARTICLE_Z_CLIP)
-		return;
-
-// project the point
-// FIXME: preadjust xcenter and ycenter
-	zi = 1.0f / transformed[2];
-	u = (int)(xcenter + zi * transformed[0] + 0.5f);
-	v = (int)(ycenter - zi * transformed[1] + 0.5f);
-
-	if ((v > d_vrectbottom_particle) || 
-		(u > d_vrectright_particle) ||
-		(v < d_vrecty) ||
-		(u < d_vrectx))
-	{
-		return;
-	}
+	int		i, pix, count;
 
 	pz = d_pzbuffer + (d_zwidth * v) + u;
 	pdest = d_viewbuffer + d_scantable[v] + u;
-	izi = (int)(zi * 0x8000);
-
-	byte color = (byte)pparticle->color;
 
 	pix = izi >> d_pix_shift;
 
@@ -205,5 +182,71 @@ PQ_FASTTEXT void D_DrawParticle (particle_t *pparticle)
 	}
 }
 
+/*
+==============
+D_DrawParticles
+
+Projects the particles a batch at a time, keeping the ones that land on
+screen, then splats the survivors.  The projection loop only reads the
+three position arrays, so it streams instead of chasing structs.
+==============
+*/
+PQ_FASTTEXT void D_DrawParticles (int count, float **org, byte *colors)
+{
+	int		base, end, i, n, u, v;
+	float	lx, ly, lz, tx, ty, tz, zi;
+	float	*x, *y, *z;
+
+	x = org[0];
+	y = org[1];
+	z = org[2];
+
+	for (base=0 ; base<count ; base=end)
+	{
+		end = base + PARTICLE_BATCH;
+		if (end > count)
+			end = count;
+
+	// transform and project the batch
+		n = 0;
+		for (i=base ; i<end ; i++)
+		{
+			lx = x[i] - r_origin[0];
+			ly = y[i] - r_origin[1];
+			lz = z[i] - r_origin[2];
+
+			tz = lx*r_ppn[0] + ly*r_ppn[1] + lz*r_ppn[2];
+			if (tz < PARTICLE_Z_CLIP)
+				continue;
+			tx = lx*r_pright[0] + ly*r_pright[1] + lz*r_pright[2];
+			ty = lx*r_pup[0] + ly*r_pup[1] + lz*r_pup[2];
+
+		// FIXME: preadjust xcenter and ycenter
+			zi = 1.0f / tz;
+			u = (int)(xcenter + zi * tx + 0.5f);
+			v = (int)(ycenter - zi * ty + 0.5f);
+
+			if ((v > d_vrectbottom_particle) || 
+				(u > d_vrectright_particle) ||
+				(v < d_vrecty) ||
+				(u < d_vrectx))
+			{
+				continue;
+			}
+
+			batch_u[n] = u;
+			batch_v[n] = v;
+			batch_izi[n] = (int)(zi * 0x8000);
+			batch_color[n] = colors[i];
+			n++;
+		}
+
+	// draw the ones that made it
+		for (i=0 ; i<n ; i++)
+			D_DrawParticleSplat (batch_u[i], batch_v[i], batch_izi[i],
+					batch_color[i]);
+	}
+}
+
 #endif	// !id386
 
@@ -650,8 +650,8 @@ PQ_FASTTEXT void D_PolysetDrawSpans8 (spanpackage_t *pspanpackage)
 		if (lcount > 0)
 		{
 #if HW_ALIAS_ACCEL
-			while (!(SPAN_STATUS & SPAN_STATUS_CAN_ACCEPT))
-				;
+			while (!span_can_accept())
+				span_pump_audio();
 			span_draw_alias_z(
 				(unsigned int)pspanpackage->pdest,
 				(unsigned int)pspanpackage->ptex,
@@ -733,8 +733,8 @@ PQ_FASTTEXT void D_PolysetDrawSpans8_NoZ (spanpackage_t *pspanpackage)
 		if (lcount > 0)
 		{
 #if HW_ALIAS_ACCEL
-			while (!(SPAN_STATUS & SPAN_STATUS_CAN_ACCEPT))
-				;
+			while (!span_can_accept())
+				span_pump_audio();
 			span_draw_alias_noz(
 				(unsigned int)pspanpackage->pdest,
 				(unsigned int)pspanpackage->ptex,
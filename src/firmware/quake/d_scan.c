@@ -316,7 +316,7 @@ void Turbulent8 (espan_t *pspan)
 D_DrawSpans8
 =============
 */
-PQ_FASTTEXT void D_DrawSpans8 (espan_t *pspan)
+PQ_HOTTEXT void D_DrawSpans8 (espan_t *pspan)
 {
 	unsigned char	*pbase;
 	unsigned int	prof_start = 0;
@@ -558,7 +558,7 @@ PQ_FASTTEXT void D_DrawSpans8 (espan_t *pspan)
 D_DrawZSpans
 =============
 */
-PQ_FASTTEXT void D_DrawZSpans (espan_t *pspan)
+PQ_HOTTEXT void D_DrawZSpans (espan_t *pspan)
 {
 	int				count, izistep;
 	int				izi;
@@ -1,6 +1,8 @@
 #ifndef DMA_ACCEL_H
 #define DMA_ACCEL_H
 
+#include "task.h"
+
 /*
  * DMA Clear/Blit Hardware Accelerator
  * Fast SDRAM fill (memset) and copy (memcpy) operations.
@@ -45,11 +47,11 @@ static inline int dma_busy(void)
     return DMA_STATUS & DMA_STATUS_BUSY;
 }
 
-/* Block until DMA completes */
+/* Block until DMA completes, running idle tasks meanwhile */
 static inline void dma_wait(void)
 {
     while (DMA_STATUS & DMA_STATUS_BUSY)
-        ;
+        Task_Idle();
 }
 
 #endif /* DMA_ACCEL_H */
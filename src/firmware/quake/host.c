@@ -47,6 +47,12 @@ float		realtime;				// without any filtering or bounding
 float		oldrealtime;			// last frame run
 int			host_framecount;
 
+float		host_tickaccum;			// time banked towards the next server tick
+float		host_tickfrac;			// host_tickaccum / tick length, for client lerp
+int			host_serverticks;		// server ticks run this frame
+unsigned int	host_servercycles;		// cycles spent in Host_ServerFrame this frame
+unsigned int	host_rendercycles;		// cycles spent in SCR_UpdateScreen this frame
+
 int			host_hunklevel;
 
 int			minimum_memory;
@@ -62,6 +68,7 @@ cvar_t	host_framerate = {"host_framerate","0"};	// set for slow motion
 cvar_t	host_speeds = {"host_speeds","0"};			// set for running times
 
 cvar_t	sys_ticrate = {"sys_ticrate","0.05"};
+cvar_t	sv_tickrate = {"sv_tickrate","0"};		// fixed server tick in Hz, 0 = once per frame
 cvar_t	serverprofile = {"serverprofile","0"};
 
 cvar_t	fraglimit = {"fraglimit","0",false,true};
@@ -242,6 +249,7 @@ void Host_InitLocal (void)
 	Cvar_RegisterVariable (&host_speeds);
 
 	Cvar_RegisterVariable (&sys_ticrate);
+	Cvar_RegisterVariable (&sv_tickrate);
 	Cvar_RegisterVariable (&serverprofile);
 
 	Cvar_RegisterVariable (&fraglimit);
@@ -625,17 +633,13 @@ void Host_ServerFrame (void)
 
 #else
 
-void Host_ServerFrame (void)
+#define	MAX_SERVERTICKS	4	// drop time rather than spiral when far behind
+
+static void Host_ServerTick (void)
 {
 // run the world state	
 	pr_global_struct->frametime = host_frametime;
 
-// set the time and clear the general datagram
-	SV_ClearDatagram ();
-	
-// check for new clients
-	SV_CheckForNewClients ();
-
 // read client messages
 	SV_RunClients ();
 	
@@ -643,9 +647,62 @@ void Host_ServerFrame (void)
 // always pause in single player if in console or menus
 	if (!sv.paused && (svs.maxclients > 1 || key_dest == key_game) )
 		SV_Physics ();
+}
 
-// send all messages to the clients
-	SV_SendClientMessages ();
+void Host_ServerFrame (void)
+{
+	float	tick;
+	float	save_host_frametime;
+
+	if (sv_tickrate.value <= 0)
+	{
+		host_tickaccum = 0;
+		host_tickfrac = 1;
+		host_serverticks = 1;
+
+	// set the time and clear the general datagram
+		SV_ClearDatagram ();
+
+	// check for new clients
+		SV_CheckForNewClients ();
+
+		Host_ServerTick ();
+
+	// send all messages to the clients
+		SV_SendClientMessages ();
+		return;
+	}
+
+//
+// fixed rate: the server only runs when a whole tick has been banked, and the
+// client interpolates between the last two ticks using host_tickfrac
+//
+	tick = 1.0f / sv_tickrate.value;
+	host_tickaccum += host_frametime;
+	host_serverticks = 0;
+
+	if (host_tickaccum >= tick)
+	{
+		SV_ClearDatagram ();
+		SV_CheckForNewClients ();
+
+		save_host_frametime = host_frametime;
+		host_frametime = tick;
+		while (host_tickaccum >= tick && host_serverticks < MAX_SERVERTICKS)
+		{
+			Host_ServerTick ();
+			host_tickaccum -= tick;
+			host_serverticks++;
+		}
+		host_frametime = save_host_frametime;
+
+		if (host_tickaccum >= tick)
+			host_tickaccum = 0;		// too far behind, don't try to catch up
+
+		SV_SendClientMessages ();
+	}
+
+	host_tickfrac = host_tickaccum / tick;
 }
 
 #endif
@@ -666,6 +723,7 @@ void _Host_Frame (float time)
 	static float		time2 = 0;
 	static float		time3 = 0;
 	int			pass1, pass2, pass3;
+	unsigned int	cycles;
 #ifdef POCKET_QUAKE
 	static int          live_hb = 0;
 #endif
@@ -689,6 +747,8 @@ void _Host_Frame (float time)
 		return;			// don't run too fast, or packets will flood out
 	pq_dbg_stage = 0x2002;
 
+	Task_Frame ();
+
 // get new key events
 	Sys_SendKeyEvents ();
 	pq_dbg_stage = 0x2003;
@@ -720,8 +780,11 @@ void _Host_Frame (float time)
 	pq_dbg_stage = 0x2008;
 	
 	((volatile char *)0x20000000)[26 * 40 + 1] = '3';  /* before ServerFrame */
+	cycles = SYS_CYCLE_LO;
+	host_serverticks = 0;
 	if (sv.active)
 		Host_ServerFrame ();
+	host_servercycles = SYS_CYCLE_LO - cycles;
 	((volatile char *)0x20000000)[26 * 40 + 1] = '4';  /* after ServerFrame */
 	pq_dbg_stage = 0x2009;
 
@@ -753,7 +816,9 @@ void _Host_Frame (float time)
 		time1 = Sys_FloatTime ();
 		
 	((volatile char *)0x20000000)[26 * 40 + 1] = '5';  /* before SCR_UpdateScreen */
+	cycles = SYS_CYCLE_LO;
 	SCR_UpdateScreen ();
+	host_rendercycles = SYS_CYCLE_LO - cycles;
 	((volatile char *)0x20000000)[26 * 40 + 1] = '6';  /* after SCR_UpdateScreen */
 	pq_dbg_stage = 0x200E;
 
@@ -785,6 +850,8 @@ void _Host_Frame (float time)
 		pass3 = (time3 - time2)*1000;
 		Con_Printf ("%3i tot %3i server %3i gfx %3i snd\n",
 					pass1+pass2+pass3, pass1, pass2, pass3);
+		Con_Printf ("cyc server %u (%i ticks) render %u\n",
+					host_servercycles, host_serverticks, host_rendercycles);
 	}
 	
 	host_framecount++;
@@ -933,6 +1000,7 @@ void Host_Init (quakeparms_t *parms)
 	Sys_Printf("Cbuf_Init OK\n");
 	Sys_Printf("Cmd_Init\n");
 	Cmd_Init ();
+	Task_Init ();
 	Sys_Printf("V_Init\n");
 	V_Init ();
 	Sys_Printf("Chase_Init...");
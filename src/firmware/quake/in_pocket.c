@@ -145,6 +145,7 @@ static int hid_to_quake(unsigned int scancode)
 static unsigned int prev_hid_scancodes[MAX_HID_KEYS];
 static unsigned int prev_hid_mods;
 static unsigned int prev_mouse_report;
+static unsigned int prev_button_report;
 static unsigned int prev_mouse_buttons;
 
 static unsigned int prev_keys = 0;
@@ -226,6 +227,86 @@ static const keymap_t keymap[] = {
     { 0, 0 }
 };
 
+/* Look input sampled by IN_LateLook after the move was sent.  It is drawn
+ * this frame and folded into cl.viewangles by the next IN_Move. */
+cvar_t in_latelook = {"in_latelook", "0", true};
+
+static float late_yaw, late_pitch;
+static qboolean late_latched;
+
+/* Consume a new mouse report's motion, if any, as a look delta */
+static void mouse_look(float *yaw, float *pitch)
+{
+    unsigned int mouse_report = MOUSE_KEY & 0xFFFF;
+
+    if (mouse_report != prev_mouse_report) {
+        unsigned int mouse_joy = MOUSE_JOY;
+        unsigned int mouse_trig = MOUSE_TRIG;
+        short delta_x = (short)(mouse_joy & 0xFFFF);
+        short delta_y = (short)(mouse_trig & 0xFFFF);
+
+        if (key_dest == key_game) {
+            *yaw -= delta_x * sensitivity.value * 0.022f;
+            *pitch += delta_y * sensitivity.value * 0.022f;
+        }
+        prev_mouse_report = mouse_report;
+    }
+}
+
+/* SNAC right stick turns at a fixed rate per frame */
+static void snac_look(unsigned int snac_joy, float *yaw, float *pitch)
+{
+    int snac_rx, snac_ry;
+
+    if (snac_joy == 0x80808080u || snac_joy == 0u)
+        return;
+
+    snac_rx = (int)((snac_joy >> 16) & 0xFF) - 128;
+    snac_ry = (int)((snac_joy >> 24) & 0xFF) - 128;
+    if (snac_rx > 16 || snac_rx < -16)
+        *yaw -= snac_rx * 0.03f;
+    if (snac_ry > 16 || snac_ry < -16)
+        *pitch += snac_ry * 0.03f;
+}
+
+/*
+ * Re-sample look input just before the view is set up.  The delta turns
+ * the refdef and the gun for this frame only; cl.viewangles, and so the
+ * command sent to the server, picks it up at the next IN_Move.  The
+ * stick's per-frame turn is taken here when this latches, and by IN_Move
+ * when it does not, so it is applied once per frame either way.
+ */
+void IN_LateLook(void)
+{
+    float yaw, pitch, limit;
+
+    if (!in_latelook.value || late_latched)
+        return;
+    if (key_dest != key_game || cl.paused || cl.intermission || cls.demoplayback)
+        return;
+    late_latched = true;
+
+    yaw = pitch = 0;
+    mouse_look(&yaw, &pitch);
+    snac_look(SNAC1_JOY, &yaw, &pitch);
+
+    /* Same pitch limits CL_AdjustAngles enforces */
+    limit = 80 - (cl.viewangles[PITCH] + late_pitch);
+    if (pitch > limit)
+        pitch = limit;
+    limit = -70 - (cl.viewangles[PITCH] + late_pitch);
+    if (pitch < limit)
+        pitch = limit;
+
+    late_yaw += yaw;
+    late_pitch += pitch;
+
+    r_refdef.viewangles[YAW] += yaw;
+    r_refdef.viewangles[PITCH] += pitch;
+    cl.viewent.angles[YAW] += yaw;
+    cl.viewent.angles[PITCH] -= pitch;
+}
+
 void IN_Init(void)
 {
     unsigned int raw_keys;
@@ -251,7 +332,10 @@ void IN_Init(void)
         prev_hid_scancodes[i] = 0;
     prev_hid_mods = 0;
     prev_mouse_report = 0;
+    prev_button_report = 0;
     prev_mouse_buttons = 0;
+
+    Cvar_RegisterVariable(&in_latelook);
 }
 
 void IN_Shutdown(void)
@@ -270,7 +354,16 @@ void IN_Move(usercmd_t *cmd)
     int lstick_x, lstick_y;
     unsigned int snac_joy;
     int snac_lx, snac_ly;
-    int snac_rx, snac_ry;
+    qboolean late_ran;
+
+    VID_LatencyMark(LAT_INPUT);
+
+    /* Look input the last frame drew early becomes authoritative */
+    cl.viewangles[YAW] += late_yaw;
+    cl.viewangles[PITCH] += late_pitch;
+    late_yaw = late_pitch = 0;
+    late_ran = late_latched;
+    late_latched = false;
 
     refresh_active_pad();
     joy = (active_pad == 1) ? CONT1_JOY : CONT2_JOY;
@@ -296,16 +389,14 @@ void IN_Move(usercmd_t *cmd)
         snac_ly = (int)((snac_joy >> 8) & 0xFF) - 128; 
         if (snac_lx > 16 || snac_lx < -16) lstick_x += snac_lx;
         if (snac_ly > 16 || snac_ly < -16) lstick_y -= snac_ly; /* fix up-down movement*/
-
-        /* Right stick for look (view angles) */
-        snac_rx = (int)((snac_joy >> 16) & 0xFF) - 128;
-        snac_ry = (int)((snac_joy >> 24) & 0xFF) - 128;
-        if (snac_rx > 16 || snac_rx < -16)
-            cl.viewangles[YAW] -= snac_rx * 0.03f;
-        if (snac_ry > 16 || snac_ry < -16)
-            cl.viewangles[PITCH] += snac_ry * 0.03f;
     }
 
+    /* Right stick for look (view angles), unless IN_LateLook took this
+     * frame's turn.  It bails while paused, in the console or when nothing
+     * was drawn, and then the turn is applied here instead of lost. */
+    if (!in_latelook.value || !late_ran)
+        snac_look(snac_joy, &cl.viewangles[YAW], &cl.viewangles[PITCH]);
+
     /* Dead zone */
     if (lstick_x > -16 && lstick_x < 16) lstick_x = 0;
     if (lstick_y > -16 && lstick_y < 16) lstick_y = 0;
@@ -320,24 +411,9 @@ void IN_Move(usercmd_t *cmd)
         if (keys & KEY_TRIG_R2)   cmd->sidemove += cl_sidespeed.value;
     }
 
-    /* Dock USB mouse: delta movement → view angles.
-     * IN_SendKeyEvents (runs first) handles button events without updating
-     * prev_mouse_report. We consume the delta and update the counter here. */
-    {
-        unsigned int mouse_report = MOUSE_KEY & 0xFFFF;
-        if (mouse_report != prev_mouse_report) {
-            unsigned int mouse_joy = MOUSE_JOY;
-            unsigned int mouse_trig = MOUSE_TRIG;
-            short delta_x = (short)(mouse_joy & 0xFFFF);
-            short delta_y = (short)(mouse_trig & 0xFFFF);
-
-            if (key_dest == key_game) {
-                cl.viewangles[YAW] -= delta_x * sensitivity.value * 0.022f;
-                cl.viewangles[PITCH] += delta_y * sensitivity.value * 0.022f;
-            }
-            prev_mouse_report = mouse_report;
-        }
-    }
+    /* Dock USB mouse: delta movement → view angles.  Any report that
+     * arrived since IN_LateLook last looked is consumed here. */
+    mouse_look(&cl.viewangles[YAW], &cl.viewangles[PITCH]);
 }
 
 void IN_SendKeyEvents(void)
@@ -518,11 +594,11 @@ void IN_SendKeyEvents(void)
     }
 
     /* ---- Dock USB mouse buttons (cont4) ---- */
-    /* Note: prev_mouse_report is updated in IN_Move (runs after this),
-     * so both functions see the same new-report condition per frame. */
+    /* Buttons keep their own report counter: IN_Move and IN_LateLook
+     * consume motion, and may do so before this sees the report. */
     {
         unsigned int mouse_report = MOUSE_KEY & 0xFFFF;
-        if (mouse_report != prev_mouse_report) {
+        if (mouse_report != prev_button_report) {
             unsigned int mouse_joy = MOUSE_JOY;
             unsigned int buttons = (mouse_joy >> 16) & 0xFFFF;
             unsigned int btn_changed = buttons ^ prev_mouse_buttons;
@@ -535,6 +611,7 @@ void IN_SendKeyEvents(void)
                 Key_Event(K_MOUSE3, (buttons & 4) ? true : false);
 
             prev_mouse_buttons = buttons;
+            prev_button_report = mouse_report;
         }
     }
 }
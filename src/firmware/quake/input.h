@@ -29,6 +29,9 @@ void IN_Commands (void);
 void IN_Move (usercmd_t *cmd);
 // add additional movement on top of the keyboard move cmd
 
+void IN_LateLook (void);
+// re-samples look input for the view about to be rendered
+
 void IN_ClearStates (void);
 // restores all button and position states to defaults
 
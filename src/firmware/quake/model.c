@@ -961,6 +961,34 @@ void Mod_LoadLeafs (lump_t *l)
 	}	
 }
 
+/*
+=================
+Mod_PackClipnodes
+
+Builds the mclipnode_t copy of a clipnode array that the hull tracer walks
+=================
+*/
+mclipnode_t *Mod_PackClipnodes (dclipnode_t *in, int count, mplane_t *planes)
+{
+	mclipnode_t	*out, *cnodes;
+	mplane_t	*plane;
+	int			i;
+
+	cnodes = out = Hunk_AllocName ( count*sizeof(*out), loadname);
+
+	for (i=0 ; i<count ; i++, out++, in++)
+	{
+		plane = planes + in->planenum;
+		out->dist = plane->dist;
+		out->children[0] = in->children[0];
+		out->children[1] = in->children[1];
+		out->type = plane->type;
+		out->planenum = in->planenum;
+	}
+
+	return cnodes;
+}
+
 /*
 =================
 Mod_LoadClipnodes
@@ -1011,6 +1039,9 @@ void Mod_LoadClipnodes (lump_t *l)
 		out->children[0] = LittleShort(in->children[0]);
 		out->children[1] = LittleShort(in->children[1]);
 	}
+
+	loadmodel->hulls[1].cnodes = loadmodel->hulls[2].cnodes =
+		Mod_PackClipnodes (loadmodel->clipnodes, count, loadmodel->planes);
 }
 
 /*
@@ -1050,6 +1081,8 @@ void Mod_MakeHull0 (void)
 				out->children[j] = child - loadmodel->nodes;
 		}
 	}
+
+	hull->cnodes = Mod_PackClipnodes (hull->clipnodes, count, loadmodel->planes);
 }
 
 /*
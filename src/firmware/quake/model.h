@@ -165,6 +165,16 @@ typedef struct mleaf_s
 	byte		ambient_sound_level[NUM_AMBIENTS];
 } mleaf_t;
 
+// clipnode with its plane's dist and type folded in, so hull traces only
+// load the plane itself for non-axial normals
+typedef struct
+{
+	float			dist;
+	short			children[2];	// negative numbers are contents
+	unsigned short	type;			// PLANE_X - PLANE_ANYZ
+	unsigned short	planenum;
+} mclipnode_t;
+
 // !!! if this is changed, it must be changed in asm_i386.h too !!!
 typedef struct
 {
@@ -174,6 +184,7 @@ typedef struct
 	int			lastclipnode;
 	vec3_t		clip_mins;
 	vec3_t		clip_maxs;
+	mclipnode_t	*cnodes;		// packed copy of clipnodes
 } hull_t;
 
 /*
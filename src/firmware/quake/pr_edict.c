@@ -52,6 +52,7 @@ cvar_t	scratch2 = {"scratch2", "0"};
 cvar_t	scratch3 = {"scratch3", "0"};
 cvar_t	scratch4 = {"scratch4", "0"};
 cvar_t	savedgamecfg = {"savedgamecfg", "0", true};
+cvar_t	pr_checklocals = {"pr_checklocals", "0"};	// verify nosave locals start clean
 cvar_t	saved1 = {"saved1", "0", true};
 cvar_t	saved2 = {"saved2", "0", true};
 cvar_t	saved3 = {"saved3", "0", true};
@@ -1072,6 +1073,8 @@ void PR_LoadProgs (void)
 
 	for (i=0 ; i<progs->numglobals ; i++)
 		((int *)pr_globals)[i] = LittleLong (((int *)pr_globals)[i]);
+
+	PR_BuildCallPlans ();
 }
 
 
@@ -1097,6 +1100,7 @@ void PR_Init (void)
 	Cvar_RegisterVariable (&saved2);
 	Cvar_RegisterVariable (&saved3);
 	Cvar_RegisterVariable (&saved4);
+	Cvar_RegisterVariable (&pr_checklocals);
 }
 
 
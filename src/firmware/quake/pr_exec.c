@@ -29,6 +29,7 @@ typedef struct
 {
 	int				s;
 	dfunction_t		*f;
+	int				saved;		// locals the callee pushed on localstack
 } prstack_t;
 
 #define	MAX_STACK_DEPTH		32
@@ -44,6 +45,43 @@ qboolean	pr_trace;
 dfunction_t	*pr_xfunction;
 int			pr_xstatement;
 
+/*
+Per-function call plans, built when progs are loaded.  The parameter copy
+is flattened into a list of source globals, and a function whose locals
+overlap no other function's only has to save them when it recurses.
+Its outermost frame skips the save and instead resets the locals to their
+load-time values on leave, which is what the save/restore would have left
+behind, so a local read before it is written still starts out as zero.
+A few cheap builtins are run straight from the OP_CALL dispatch.
+*/
+enum
+{
+	PRB_NONE,
+	PRB_MAKEVECTORS,
+	PRB_RANDOM,
+	PRB_NORMALIZE,
+	PRB_VLEN
+};
+
+typedef struct
+{
+	unsigned short	*parmsrc;		// global each parm word is copied from
+	int				*localinit;		// load-time values of the locals, if nosave
+	byte			nparmwords;
+	byte			nosave;			// locals overlap no other function
+	byte			builtin;		// PRB_*, for inlined builtins
+	unsigned short	active;			// frames of this function on pr_stack
+} prcallplan_t;
+
+static prcallplan_t	*pr_callplans;
+
+extern cvar_t	pr_checklocals;
+
+void PF_makevectors (void);
+void PF_random (void);
+void PF_normalize (void);
+void PF_vlen (void);
+
 
 int		pr_argc;
 
@@ -262,6 +300,7 @@ void PR_RunError (char *error, ...)
 {
 	va_list		argptr;
 	char		string[1024];
+	int			i;
 
 	va_start (argptr,error);
 	vsprintf (string,error,argptr);
@@ -272,10 +311,122 @@ void PR_RunError (char *error, ...)
 	Con_Printf ("%s\n", string);
 	
 	pr_depth = 0;		// dump the stack so host_error can shutdown functions
+	localstack_used = 0;
+	if (pr_callplans)
+		for (i=0 ; i<progs->numfunctions ; i++)
+		{
+			pr_callplans[i].active = 0;
+			if (pr_callplans[i].nosave)
+				memcpy ((int *)pr_globals + pr_functions[i].parm_start,
+						pr_callplans[i].localinit, pr_functions[i].locals * 4);
+		}
 
 	Host_Error ("Program error");
 }
 
+/*
+====================
+PR_CompareParmStart
+====================
+*/
+static int PR_CompareParmStart (const void *a, const void *b)
+{
+	return pr_functions[*(int *)a].parm_start - pr_functions[*(int *)b].parm_start;
+}
+
+/*
+====================
+PR_BuildCallPlans
+
+Called from PR_LoadProgs once the functions are byte swapped
+====================
+*/
+void PR_BuildCallPlans (void)
+{
+	int				i, j, k, n, words, end, *order, *init;
+	dfunction_t		*f;
+	prcallplan_t	*plan;
+	unsigned short	*src;
+	builtin_t		b;
+
+	n = progs->numfunctions;
+	pr_callplans = Hunk_AllocName (n * sizeof(prcallplan_t), "callplan");
+
+	words = 0;
+	for (i=0, f=pr_functions ; i<n ; i++, f++)
+		for (j=0 ; j<f->numparms && j<MAX_PARMS ; j++)
+			words += f->parm_size[j];
+	src = Hunk_AllocName ((words + 1) * sizeof(unsigned short), "callplan");
+
+	for (i=0, f=pr_functions, plan=pr_callplans ; i<n ; i++, f++, plan++)
+	{
+		plan->parmsrc = src;
+		for (j=0 ; j<f->numparms && j<MAX_PARMS ; j++)
+			for (k=0 ; k<f->parm_size[j] ; k++)
+				*src++ = OFS_PARM0 + j*3 + k;
+		plan->nparmwords = src - plan->parmsrc;
+
+		if (f->first_statement < 0 && -f->first_statement < pr_numbuiltins)
+		{
+			b = pr_builtins[-f->first_statement];
+			if (b == PF_makevectors)
+				plan->builtin = PRB_MAKEVECTORS;
+			else if (b == PF_random)
+				plan->builtin = PRB_RANDOM;
+			else if (b == PF_normalize)
+				plan->builtin = PRB_NORMALIZE;
+			else if (b == PF_vlen)
+				plan->builtin = PRB_VLEN;
+		}
+	}
+
+// sort the functions by where their locals start and look for overlaps
+	order = Hunk_TempAlloc (n * sizeof(int));
+	for (i=0 ; i<n ; i++)
+		order[i] = i;
+	qsort (order, n, sizeof(int), PR_CompareParmStart);
+
+	end = 0;
+	for (i=0 ; i<n ; i++)
+	{
+		f = &pr_functions[order[i]];
+		if (f->first_statement < 0 || !f->locals)
+			continue;
+		pr_callplans[order[i]].nosave = true;
+		if (f->parm_start < end)
+		{
+		// overlaps the function(s) before it; neither can skip the save
+			pr_callplans[order[i]].nosave = false;
+			for (j=i-1 ; j>=0 ; j--)
+			{
+				k = order[j];
+				if (pr_functions[k].first_statement < 0 || !pr_functions[k].locals)
+					continue;
+				if (pr_functions[k].parm_start + pr_functions[k].locals <= f->parm_start)
+					continue;
+				pr_callplans[k].nosave = false;
+			}
+		}
+		if (f->parm_start + f->locals > end)
+			end = f->parm_start + f->locals;
+	}
+
+// keep the load-time values nosave locals are reset to
+	words = 0;
+	for (i=0 ; i<n ; i++)
+		if (pr_callplans[i].nosave)
+			words += pr_functions[i].locals;
+	init = Hunk_AllocName ((words + 1) * sizeof(int), "callplan");
+	for (i=0, f=pr_functions, plan=pr_callplans ; i<n ; i++, f++, plan++)
+	{
+		if (!plan->nosave)
+			continue;
+		plan->localinit = init;
+		memcpy (init, (int *)pr_globals + f->parm_start, f->locals * 4);
+		init += f->locals;
+	}
+}
+
 /*
 ============================================================================
 PR_ExecuteProgram
@@ -293,33 +444,49 @@ Returns the new program statement counter
 */
 int PR_EnterFunction (dfunction_t *f)
 {
-	int		i, j, c, o;
+	int				i, c, *globals, *dst;
+	prcallplan_t	*plan;
+	unsigned short	*src;
+
+	plan = &pr_callplans[f - pr_functions];
+	globals = (int *)pr_globals;
+
+// save off any locals that the new function steps on; if no other
+// function shares them they are only live when this one recurses
+	if (plan->nosave && !plan->active)
+	{
+		c = 0;
+		if (pr_checklocals.value)
+			for (i=0 ; i < f->locals ; i++)
+				if (globals[f->parm_start + i] != plan->localinit[i])
+					PR_RunError ("%s: local %i not reset since the last call",
+							pr_strings + f->s_name, i);
+	}
+	else
+	{
+		c = f->locals;
+		if (localstack_used + c > LOCALSTACK_SIZE)
+			PR_RunError ("PR_ExecuteProgram: locals stack overflow\n");
+
+		dst = localstack + localstack_used;
+		for (i=0 ; i < c ; i++)
+			dst[i] = globals[f->parm_start + i];
+		localstack_used += c;
+	}
 
 	pr_stack[pr_depth].s = pr_xstatement;
 	pr_stack[pr_depth].f = pr_xfunction;	
+	pr_stack[pr_depth].saved = c;
 	pr_depth++;
 	if (pr_depth >= MAX_STACK_DEPTH)
 		PR_RunError ("stack overflow");
-
-// save off any locals that the new function steps on
-	c = f->locals;
-	if (localstack_used + c > LOCALSTACK_SIZE)
-		PR_RunError ("PR_ExecuteProgram: locals stack overflow\n");
-
-	for (i=0 ; i < c ; i++)
-		localstack[localstack_used+i] = ((int *)pr_globals)[f->parm_start + i];
-	localstack_used += c;
+	plan->active++;
 
 // copy parameters
-	o = f->parm_start;
-	for (i=0 ; i<f->numparms ; i++)
-	{
-		for (j=0 ; j<f->parm_size[i] ; j++)
-		{
-			((int *)pr_globals)[o] = ((int *)pr_globals)[OFS_PARM0+i*3+j];
-			o++;
-		}
-	}
+	dst = globals + f->parm_start;
+	src = plan->parmsrc;
+	for (i=0 ; i<plan->nparmwords ; i++)
+		dst[i] = globals[src[i]];
 
 	pr_xfunction = f;
 	return f->first_statement - 1;	// offset the s++
@@ -332,13 +499,17 @@ PR_LeaveFunction
 */
 int PR_LeaveFunction (void)
 {
-	int		i, c;
+	int				i, c;
+	prcallplan_t	*plan;
 
 	if (pr_depth <= 0)
 		Sys_Error ("prog stack underflow");
 
+// up stack
+	pr_depth--;
+
 // restore locals from the stack
-	c = pr_xfunction->locals;
+	c = pr_stack[pr_depth].saved;
 	localstack_used -= c;
 	if (localstack_used < 0)
 		PR_RunError ("PR_ExecuteProgram: locals stack underflow\n");
@@ -346,8 +517,14 @@ int PR_LeaveFunction (void)
 	for (i=0 ; i < c ; i++)
 		((int *)pr_globals)[pr_xfunction->parm_start + i] = localstack[localstack_used+i];
 
-// up stack
-	pr_depth--;
+// the outermost frame of a nosave function saved nothing; put the locals
+// back the way it found them
+	plan = &pr_callplans[pr_xfunction - pr_functions];
+	if (plan->nosave && plan->active == 1)
+		memcpy ((int *)pr_globals + pr_xfunction->parm_start, plan->localinit,
+				pr_xfunction->locals * 4);
+
+	plan->active--;
 	pr_xfunction = pr_stack[pr_depth].f;
 	return pr_stack[pr_depth].s;
 }
@@ -623,6 +800,43 @@ while (1)
 
 		newf = &pr_functions[a->function];
 
+		switch (pr_callplans[a->function].builtin)
+		{
+		case PRB_MAKEVECTORS:
+			AngleVectors (G_VECTOR(OFS_PARM0), pr_global_struct->v_forward,
+					pr_global_struct->v_right, pr_global_struct->v_up);
+			continue;
+		case PRB_RANDOM:
+			G_FLOAT(OFS_RETURN) = (rand ()&0x7fff) / ((float)0x7fff);
+			continue;
+		case PRB_NORMALIZE:
+			{
+				float	*v, len;
+
+				v = G_VECTOR(OFS_PARM0);
+				len = sqrtf (v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+				if (len == 0)
+					G_VECTOR(OFS_RETURN)[0] = G_VECTOR(OFS_RETURN)[1] =
+						G_VECTOR(OFS_RETURN)[2] = 0;
+				else
+				{
+					len = 1/len;
+					G_VECTOR(OFS_RETURN)[0] = v[0] * len;
+					G_VECTOR(OFS_RETURN)[1] = v[1] * len;
+					G_VECTOR(OFS_RETURN)[2] = v[2] * len;
+				}
+			}
+			continue;
+		case PRB_VLEN:
+			{
+				float	*v;
+
+				v = G_VECTOR(OFS_PARM0);
+				G_FLOAT(OFS_RETURN) = sqrtf (v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+			}
+			continue;
+		}
+
 		if (newf->first_statement < 0)
 		{	// negative statements are built in functions
 			i = -newf->first_statement;
@@ -114,13 +114,18 @@ void	VID_UnlockBuffer (void);
 
 #define	MAX_STYLESTRING	64
 
-/* Optional placement hints for hot code/data on PocketQuake. */
+/* Optional placement hints for hot code/data on PocketQuake.
+ * PQ_HOTTEXT is only for the edge scan and span inner loops: they are
+ * linked as one block at the start of PSRAM .text that must fit the 16KB
+ * I-cache (linker.ld asserts it), so none of them can evict another. */
 #if defined(POCKET_QUAKE)
 #define PQ_FASTTEXT
+#define PQ_HOTTEXT    __attribute__((section(".text.pqhot")))
 #define PQ_FASTDATA   __attribute__((section(".fastdata")))
 #define PQ_FASTRODATA __attribute__((section(".fastrodata")))
 #else
 #define PQ_FASTTEXT
+#define PQ_HOTTEXT
 #define PQ_FASTDATA
 #define PQ_FASTRODATA
 #endif
@@ -270,6 +275,7 @@ typedef struct
 #include "menu.h"
 #include "crc.h"
 #include "cdaudio.h"
+#include "task.h"
 
 #ifdef GLQUAKE
 #include "glquake.h"
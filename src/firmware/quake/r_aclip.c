@@ -236,7 +236,7 @@ R_AliasClipTriangle
 PQ_FASTTEXT void R_AliasClipTriangle (mtriangle_t *ptri)
 {
 	int				i, k, pingpong;
-	mtriangle_t		mtri;
+	mtriangle_t		fan[8];
 	unsigned		clipflags;
 
 // copy vertexes and fix seam texture coordinates
@@ -333,18 +333,17 @@ PQ_FASTTEXT void R_AliasClipTriangle (mtriangle_t *ptri)
 		fv[pingpong][i].flags = 0;
 	}
 
-// draw triangles
-	mtri.facesfront = ptri->facesfront;
-	r_affinetridesc.ptriangles = &mtri;
-	r_affinetridesc.pfinalverts = fv[pingpong];
-
-// FIXME: do all at once as trifan?
-	mtri.vertindex[0] = 0;
+// draw the clipped polygon as one fan
 	for (i=1 ; i<k-1 ; i++)
 	{
-		mtri.vertindex[1] = i;
-		mtri.vertindex[2] = i+1;
-		D_PolysetDraw ();
+		fan[i-1].facesfront = ptri->facesfront;
+		fan[i-1].vertindex[0] = 0;
+		fan[i-1].vertindex[1] = i;
+		fan[i-1].vertindex[2] = i+1;
 	}
+	r_affinetridesc.ptriangles = fan;
+	r_affinetridesc.pfinalverts = fv[pingpong];
+	r_affinetridesc.numtriangles = k - 2;
+	D_PolysetDraw ();
 }
 
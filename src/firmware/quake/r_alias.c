@@ -259,6 +259,24 @@ void R_AliasTransformVector (vec3_t in, vec3_t out)
 }
 
 
+/*
+================
+R_AliasFlushRun
+
+Draws the unclipped triangles [pfirst, pend) in one rasterizer call
+================
+*/
+static void R_AliasFlushRun (mtriangle_t *pfirst, mtriangle_t *pend)
+{
+	if (pend == pfirst)
+		return;
+
+	r_affinetridesc.pfinalverts = pfinalverts;
+	r_affinetridesc.ptriangles = pfirst;
+	r_affinetridesc.numtriangles = pend - pfirst;
+	D_PolysetDraw ();
+}
+
 /*
 ================
 R_AliasPreparePoints
@@ -272,7 +290,7 @@ void R_AliasPreparePoints (void)
 	stvert_t	*pstverts;
 	finalvert_t	*fv;
 	auxvert_t	*av;
-	mtriangle_t	*ptri;
+	mtriangle_t	*ptri, *prun;
 	finalvert_t	*pfv[3];
 
 	pstverts = (stvert_t *)((byte *)paliashdr + paliashdr->stverts);
@@ -303,30 +321,31 @@ void R_AliasPreparePoints (void)
 //
 // clip and draw all triangles
 //
-	r_affinetridesc.numtriangles = 1;
-
+// runs of unclipped triangles go to the rasterizer as one batch; a clipped
+// or rejected triangle ends the run so the draw order is unchanged, which
+// matters for the viewmodel since it draws without z
+//
 	ptri = (mtriangle_t *)((byte *)paliashdr + paliashdr->triangles);
+	prun = ptri;
 	for (i=0 ; i<pmdl->numtris ; i++, ptri++)
 	{
 		pfv[0] = &pfinalverts[ptri->vertindex[0]];
 		pfv[1] = &pfinalverts[ptri->vertindex[1]];
 		pfv[2] = &pfinalverts[ptri->vertindex[2]];
 
-		if ( pfv[0]->flags & pfv[1]->flags & pfv[2]->flags & (ALIAS_XY_CLIP_MASK | ALIAS_Z_CLIP) )
-			continue;		// completely clipped
-		
 		if ( ! ( (pfv[0]->flags | pfv[1]->flags | pfv[2]->flags) &
 			(ALIAS_XY_CLIP_MASK | ALIAS_Z_CLIP) ) )
-		{	// totally unclipped
-			r_affinetridesc.pfinalverts = pfinalverts;
-			r_affinetridesc.ptriangles = ptri;
-			D_PolysetDraw ();
-		}
-		else		
-		{	// partially clipped
-			R_AliasClipTriangle (ptri);
-		}
+			continue;		// totally unclipped, extend the run
+
+		R_AliasFlushRun (prun, ptri);
+		prun = ptri + 1;
+
+		if ( pfv[0]->flags & pfv[1]->flags & pfv[2]->flags & (ALIAS_XY_CLIP_MASK | ALIAS_Z_CLIP) )
+			continue;		// completely clipped
+
+		R_AliasClipTriangle (ptri);	// partially clipped
 	}
+	R_AliasFlushRun (prun, ptri);
 }
 
 
@@ -66,6 +66,38 @@ static mvertex_t	*pfrontenter, *pfrontexit;
 
 static qboolean		makeclippededge;
 
+//
+// cross-frame world edge reuse: while the view is unchanged the world pass
+// produces the same edges and surfaces every frame, so the output of one
+// pass is saved and copied back instead of walking the BSP again
+//
+typedef struct
+{
+	vec3_t		origin, vpn, vright, vup;
+	float		xscale, yscale, xcenter, ycenter;
+	vrect_t		vrect;
+	float		cullsize;
+	int			draworder;
+	int			visframecount;
+	mleaf_t		*viewleaf;
+} worldview_t;
+
+#define MAX_SAVED_EFRAGLEAFS	256
+
+cvar_t		r_edgereuse = {"r_edgereuse", "0"};	// read at map load
+
+static worldview_t	r_lastworldview, r_savedworldview;
+static qboolean		r_worldsaved;		// saved pass matches r_savedworldview
+static qboolean		r_worldrecord;		// this pass is being recorded
+
+static edge_t		*r_savededges;
+static surf_t		*r_savedsurfs;
+static edge_t		**r_savednewedges, **r_savedremoveedges;
+static int			r_numsavededges, r_numsavedsurfs, r_savedkey;
+static int			r_maxsavededges, r_maxsavedsurfs;
+static mleaf_t		*r_savedefragleafs[MAX_SAVED_EFRAGLEAFS];
+static int			r_numsavedefragleafs;
+
 
 //===========================================================================
 
@@ -467,27 +499,69 @@ void R_DrawSubmodelPolygons (model_t *pmodel, int clipflags)
 }
 
 
+/*
+================
+R_CullWorldNodes
+
+Drops solid and non-visible nodes, then runs the rest through the frustum
+in one batch.  flags[i] is -1 for a culled node, otherwise the clipflags
+to recurse with.
+================
+*/
+static inline void R_CullWorldNodes (mnode_t **nodes, int count, int clipflags,
+	int *flags)
+{
+	short	*boxes[2];
+	int		slot[2], boxflags[2];
+	int		i, n;
+	mnode_t	*node;
+
+	n = 0;
+	for (i=0 ; i<count ; i++)
+	{
+		node = nodes[i];
+		flags[i] = -1;
+
+		if (node->contents == CONTENTS_SOLID)
+			continue;		// solid
+		if (node->visframe != r_visframecount)
+			continue;
+
+		if (!clipflags)
+		{
+			flags[i] = 0;	// parent was trivially accepted
+			continue;
+		}
+		boxes[n] = node->minmaxs;
+		slot[n++] = i;
+	}
+
+	if (n)
+	{
+		R_CullBoxes (boxes, n, clipflags, boxflags);
+		for (i=0 ; i<n ; i++)
+			flags[slot[i]] = boxflags[i];
+	}
+}
+
+
 /*
 ================
 R_RecursiveWorldNode
+
+node has already passed R_CullWorldNodes
 ================
 */
 PQ_FASTTEXT void R_RecursiveWorldNode (mnode_t *node, int clipflags)
 {
-	int			i, c, side, *pindex;
+	int			c, side, childflags[2];
 	mplane_t	*plane;
 	msurface_t	*surf, **mark;
 	mleaf_t		*pleaf;
-	float		d, dot;
+	float		dot;
 	int			profiling = (int)pq_cycleprof.value;
 	unsigned int prof_t;
 
-	if (node->contents == CONTENTS_SOLID)
-		return;		// solid
-
-	if (node->visframe != r_visframecount)
-		return;
-
 // size cull: skip subtree if its bounding box projects smaller than r_cullsize pixels
 	if (cull_threshold_sq > 0)
 	{
@@ -523,39 +597,6 @@ PQ_FASTTEXT void R_RecursiveWorldNode (mnode_t *node, int clipflags)
 		}
 	}
 
-// cull the clipping planes if not trivial accept
-// FIXME: the compiler is doing a lousy job of optimizing here; it could be
-//  twice as fast in ASM
-	if (clipflags)
-	{
-		for (i=0 ; i<4 ; i++)
-		{
-			float *n;
-			float dist;
-
-			if (! (clipflags & (1<<i)) )
-				continue;
-
-			pindex = pfrustum_indexes[i];
-			n = view_clipplanes[i].normal;
-			dist = view_clipplanes[i].dist;
-
-			d = (float)node->minmaxs[pindex[0]] * n[0] +
-			    (float)node->minmaxs[pindex[1]] * n[1] +
-			    (float)node->minmaxs[pindex[2]] * n[2] - dist;
-
-			if (d <= 0)
-				return;
-
-			d = (float)node->minmaxs[pindex[3]] * n[0] +
-			    (float)node->minmaxs[pindex[4]] * n[1] +
-			    (float)node->minmaxs[pindex[5]] * n[2] - dist;
-
-			if (d >= 0)
-				clipflags &= ~(1<<i);
-		}
-	}
-
 // if a leaf node, draw stuff
 	if (node->contents < 0)
 	{
@@ -577,6 +618,14 @@ PQ_FASTTEXT void R_RecursiveWorldNode (mnode_t *node, int clipflags)
 		if (pleaf->efrags)
 		{
 			R_StoreEfrags (&pleaf->efrags);
+
+			if (r_worldrecord)
+			{
+				if (r_numsavedefragleafs == MAX_SAVED_EFRAGLEAFS)
+					r_worldrecord = false;
+				else
+					r_savedefragleafs[r_numsavedefragleafs++] = pleaf;
+			}
 		}
 
 		pleaf->key = r_currentkey;
@@ -610,8 +659,13 @@ PQ_FASTTEXT void R_RecursiveWorldNode (mnode_t *node, int clipflags)
 		else
 			side = 1;
 
+	// both children are tested against the same parent clipflags, so
+	// they can be culled together up front
+		R_CullWorldNodes (node->children, 2, clipflags, childflags);
+
 	// recurse down the children, front side first
-		R_RecursiveWorldNode (node->children[side], clipflags);
+		if (childflags[side] >= 0)
+			R_RecursiveWorldNode (node->children[side], childflags[side]);
 
 	// draw stuff
 		c = node->numsurfaces;
@@ -654,11 +708,132 @@ PQ_FASTTEXT void R_RecursiveWorldNode (mnode_t *node, int clipflags)
 		}
 
 	// recurse down the back side
-		R_RecursiveWorldNode (node->children[!side], clipflags);
+		if (childflags[!side] >= 0)
+			R_RecursiveWorldNode (node->children[!side], childflags[!side]);
+	}
+}
+
+
+
+/*
+================
+R_InitWorldEdgeCache
+
+Called at map load, after the edge and surface arrays are sized.  The
+save buffers (about r_maxedges edges plus r_maxsurfs surfaces) only come
+out of the hunk when r_edgereuse is set, so turning it on takes effect
+at the next map load.
+================
+*/
+void R_InitWorldEdgeCache (void)
+{
+	R_InvalidateWorldEdges ();
+
+	if (!r_edgereuse.value)
+	{
+		r_savededges = NULL;	// R_RenderWorld skips the cache
+		r_savedsurfs = NULL;
+		r_savednewedges = r_savedremoveedges = NULL;
+		return;
 	}
+
+	r_maxsavededges = r_numallocatededges;
+	r_maxsavedsurfs = r_cnumsurfs + 1;
+	r_savededges = Hunk_AllocName (r_maxsavededges * sizeof(edge_t), "savededges");
+	r_savedsurfs = Hunk_AllocName (r_maxsavedsurfs * sizeof(surf_t), "savedsurfs");
+	r_savednewedges = Hunk_AllocName (MAXHEIGHT * sizeof(edge_t *), "savednew");
+	r_savedremoveedges = Hunk_AllocName (MAXHEIGHT * sizeof(edge_t *), "savedremove");
+}
+
+/*
+================
+R_InvalidateWorldEdges
+
+The view rect, projection or visible leaf set changed
+================
+*/
+void R_InvalidateWorldEdges (void)
+{
+	r_worldsaved = false;
+	memset (&r_lastworldview, 0, sizeof(r_lastworldview));
+}
+
+static void R_GetWorldView (worldview_t *wv)
+{
+	memset (wv, 0, sizeof(*wv));	// memcmp'd, so no stray padding
+	VectorCopy (r_origin, wv->origin);
+	VectorCopy (vpn, wv->vpn);
+	VectorCopy (vright, wv->vright);
+	VectorCopy (vup, wv->vup);
+	wv->xscale = xscale;
+	wv->yscale = yscale;
+	wv->xcenter = xcenter;
+	wv->ycenter = ycenter;
+	wv->vrect = r_refdef.vrect;
+	wv->cullsize = r_cullsize.value;
+	wv->draworder = (int)r_draworder.value;
+	wv->visframecount = r_visframecount;
+	wv->viewleaf = r_viewleaf;
+}
+
+/*
+================
+R_SaveWorldEdges
+================
+*/
+static void R_SaveWorldEdges (worldview_t *wv)
+{
+	int		top, height;
+
+	r_numsavededges = edge_p - r_edges;
+	r_numsavedsurfs = surface_p - surfaces;
+	if (r_numsavededges > r_maxsavededges || r_numsavedsurfs > r_maxsavedsurfs)
+		return;
+
+	memcpy (r_savededges, r_edges, r_numsavededges * sizeof(edge_t));
+	// surfaces[0] is the dummy the scan rebuilds each frame, and with
+	// r_surfsonstack it can sit before the scratch array, so skip it
+	memcpy (r_savedsurfs, surfaces + 1, (r_numsavedsurfs - 1) * sizeof(surf_t));
+
+	top = r_refdef.vrect.y;
+	height = r_refdef.vrectbottom - top;
+	memcpy (r_savednewedges + top, newedges + top, height * sizeof(edge_t *));
+	memcpy (r_savedremoveedges + top, removeedges + top, height * sizeof(edge_t *));
+
+	r_savedkey = r_currentkey;
+	r_savedworldview = *wv;
+	r_worldsaved = true;
 }
 
+/*
+================
+R_RestoreWorldEdges
+
+Edges and surfaces are copied back to the same addresses, so the links
+between them stay valid.  The dummy surface 0 is left alone.  The static
+entities the BSP walk would have found are stored again from the recorded
+leafs.
+================
+*/
+static void R_RestoreWorldEdges (void)
+{
+	int		i, top, height;
 
+	memcpy (r_edges, r_savededges, r_numsavededges * sizeof(edge_t));
+	memcpy (surfaces + 1, r_savedsurfs, (r_numsavedsurfs - 1) * sizeof(surf_t));
+	edge_p = r_edges + r_numsavededges;
+	surface_p = surfaces + r_numsavedsurfs;
+
+	top = r_refdef.vrect.y;
+	height = r_refdef.vrectbottom - top;
+	memcpy (newedges + top, r_savednewedges + top, height * sizeof(edge_t *));
+	memcpy (removeedges + top, r_savedremoveedges + top, height * sizeof(edge_t *));
+
+	r_currentkey = r_savedkey;
+
+	for (i=0 ; i<r_numsavedefragleafs ; i++)
+		R_StoreEfrags (&r_savedefragleafs[i]->efrags);
+}
 
 /*
 ================
@@ -667,9 +842,11 @@ R_RenderWorld
 */
 void R_RenderWorld (void)
 {
-	int			i;
+	int			i, rootflags;
 	model_t		*clmodel;
 	btofpoly_t	btofpolys[MAX_BTOFPOLYS];
+	worldview_t	wv;
+	int			outofsurfs, outofedges;
 
 	pbtofpolys = btofpolys;
 
@@ -677,11 +854,41 @@ void R_RenderWorld (void)
 	VectorCopy (r_origin, modelorg);
 	clmodel = currententity->model;
 	r_pcurrentvertbase = clmodel->vertexes;
+	R_NewVertCacheView ();
 
 	cull_threshold_sq = r_cullsize.value * r_cullsize.value;
 	cull_xscale_sq = xscale * xscale;
 
-	R_RecursiveWorldNode (clmodel->nodes, 15);
+	r_worldrecord = false;
+	if (r_edgereuse.value && !r_worldpolysbacktofront && r_savededges)
+	{
+		R_GetWorldView (&wv);
+		if (r_worldsaved && !memcmp (&wv, &r_savedworldview, sizeof(wv)))
+		{
+			R_RestoreWorldEdges ();
+			return;
+		}
+
+	// record once the view has held still for a frame
+		r_worldsaved = false;
+		r_worldrecord = !memcmp (&wv, &r_lastworldview, sizeof(wv));
+		r_lastworldview = wv;
+		r_numsavedefragleafs = 0;
+	}
+
+	outofsurfs = r_outofsurfaces;
+	outofedges = r_outofedges;
+
+	R_CullWorldNodes (&clmodel->nodes, 1, 15, &rootflags);
+	if (rootflags >= 0)
+		R_RecursiveWorldNode (clmodel->nodes, rootflags);
+
+	if (r_worldrecord && outofsurfs == r_outofsurfaces &&
+		outofedges == r_outofedges)
+	{
+		R_SaveWorldEdges (&wv);
+	}
+	r_worldrecord = false;
 
 // if the driver wants the polygons back to front, play the visible ones back
 // in that order
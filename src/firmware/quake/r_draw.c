@@ -76,6 +76,111 @@ int				r_ceilv1;
 
 qboolean	r_lastvertvalid;
 
+//
+// per-view projection cache for world vertices; every vertex is shared by
+// several edges, and edges that are not cached still share their ends
+//
+typedef struct
+{
+	float	u, v, lzi;
+	int		ceilv;
+	int		gen;
+} vertproj_t;
+
+cvar_t		r_vertcache = {"r_vertcache", "1"};
+
+static vertproj_t	*r_vertproj;
+static mvertex_t	*r_vertprojbase;
+static unsigned		r_numvertproj;		// entries allocated
+static unsigned		r_vertprojlimit;	// entries in use, 0 when disabled
+static int			r_vertprojgen;
+
+/*
+================
+R_InitVertCache
+
+Called at map load, after the hunk mark for the level
+================
+*/
+void R_InitVertCache (void)
+{
+	r_vertprojbase = cl.worldmodel->vertexes;
+	r_numvertproj = cl.worldmodel->numvertexes;
+	r_vertproj = Hunk_AllocName (r_numvertproj * sizeof(vertproj_t), "vertproj");
+	r_vertprojgen = 0;
+}
+
+/*
+================
+R_NewVertCacheView
+
+Invalidates the cache; called whenever modelorg or the view axes change.
+Inline brush models share the world vertex array, so one cache covers both.
+================
+*/
+void R_NewVertCacheView (void)
+{
+	r_vertprojgen++;
+	r_vertprojlimit = r_vertcache.value ? r_numvertproj : 0;
+}
+
+/*
+================
+R_ProjectVertex
+
+Clipped vertices live outside the vertex array and are never cached
+================
+*/
+static inline vertproj_t *R_ProjectVertex (mvertex_t *pv)
+{
+	static vertproj_t	scratch;
+	vertproj_t	*pp;
+	unsigned	index;
+	vec3_t		local, transformed;
+	float		scale, u, v, lzi;
+
+	index = pv - r_vertprojbase;
+	if (index < r_vertprojlimit)
+	{
+		pp = &r_vertproj[index];
+		if (pp->gen == r_vertprojgen)
+			return pp;
+		pp->gen = r_vertprojgen;
+	}
+	else
+		pp = &scratch;
+
+// transform and project
+	VectorSubtract (pv->position, modelorg, local);
+	TransformVector (local, transformed);
+
+	if (transformed[2] < NEAR_CLIP)
+		transformed[2] = NEAR_CLIP;
+
+	lzi = 1.0f / transformed[2];
+
+// FIXME: build x/yscale into transform?
+	scale = xscale * lzi;
+	u = (xcenter + scale*transformed[0]);
+	if (u < r_refdef.fvrectx_adj)
+		u = r_refdef.fvrectx_adj;
+	if (u > r_refdef.fvrectright_adj)
+		u = r_refdef.fvrectright_adj;
+
+	scale = yscale * lzi;
+	v = (ycenter - scale*transformed[1]);
+	if (v < r_refdef.fvrecty_adj)
+		v = r_refdef.fvrecty_adj;
+	if (v > r_refdef.fvrectbottom_adj)
+		v = r_refdef.fvrectbottom_adj;
+
+	pp->u = u;
+	pp->v = v;
+	pp->lzi = lzi;
+	pp->ceilv = pq_ceilf_int(v);
+	return pp;
+}
+
 
 #if	!id386
 
@@ -89,10 +194,9 @@ PQ_FASTTEXT void R_EmitEdge (mvertex_t *pv0, mvertex_t *pv1)
 	edge_t	*edge, *pcheck;
 	int		u_check;
 	float	u, u_step;
-	vec3_t	local, transformed;
-	float	*world;
+	vertproj_t	*pp;
 	int		v, v2, ceilv0;
-	float	scale, lzi0, u0, v0;
+	float	lzi0, u0, v0;
 	int		side;
 
 	if (r_lastvertvalid)
@@ -104,59 +208,17 @@ PQ_FASTTEXT void R_EmitEdge (mvertex_t *pv0, mvertex_t *pv1)
 	}
 	else
 	{
-		world = &pv0->position[0];
-	
-	// transform and project
-		VectorSubtract (world, modelorg, local);
-		TransformVector (local, transformed);
-	
-		if (transformed[2] < NEAR_CLIP)
-			transformed[2] = NEAR_CLIP;
-	
-		lzi0 = 1.0f / transformed[2];
-	
-	// FIXME: build x/yscale into transform?
-		scale = xscale * lzi0;
-		u0 = (xcenter + scale*transformed[0]);
-		if (u0 < r_refdef.fvrectx_adj)
-			u0 = r_refdef.fvrectx_adj;
-		if (u0 > r_refdef.fvrectright_adj)
-			u0 = r_refdef.fvrectright_adj;
-	
-		scale = yscale * lzi0;
-		v0 = (ycenter - scale*transformed[1]);
-		if (v0 < r_refdef.fvrecty_adj)
-			v0 = r_refdef.fvrecty_adj;
-		if (v0 > r_refdef.fvrectbottom_adj)
-			v0 = r_refdef.fvrectbottom_adj;
-	
-		ceilv0 = pq_ceilf_int(v0);
+		pp = R_ProjectVertex (pv0);
+		u0 = pp->u;
+		v0 = pp->v;
+		lzi0 = pp->lzi;
+		ceilv0 = pp->ceilv;
 	}
 
-	world = &pv1->position[0];
-
-// transform and project
-	VectorSubtract (world, modelorg, local);
-	TransformVector (local, transformed);
-
-	if (transformed[2] < NEAR_CLIP)
-		transformed[2] = NEAR_CLIP;
-
-	r_lzi1 = 1.0f / transformed[2];
-
-	scale = xscale * r_lzi1;
-	r_u1 = (xcenter + scale*transformed[0]);
-	if (r_u1 < r_refdef.fvrectx_adj)
-		r_u1 = r_refdef.fvrectx_adj;
-	if (r_u1 > r_refdef.fvrectright_adj)
-		r_u1 = r_refdef.fvrectright_adj;
-
-	scale = yscale * r_lzi1;
-	r_v1 = (ycenter - scale*transformed[1]);
-	if (r_v1 < r_refdef.fvrecty_adj)
-		r_v1 = r_refdef.fvrecty_adj;
-	if (r_v1 > r_refdef.fvrectbottom_adj)
-		r_v1 = r_refdef.fvrectbottom_adj;
+	pp = R_ProjectVertex (pv1);
+	r_u1 = pp->u;
+	r_v1 = pp->v;
+	r_lzi1 = pp->lzi;
 
 	if (r_lzi1 > lzi0)
 		lzi0 = r_lzi1;
@@ -170,7 +232,7 @@ PQ_FASTTEXT void R_EmitEdge (mvertex_t *pv0, mvertex_t *pv1)
 
 	r_emitted = 1;
 
-	r_ceilv1 = pq_ceilf_int(r_v1);
+	r_ceilv1 = pp->ceilv;
 
 
 // create the edge
@@ -109,6 +109,8 @@ static unsigned short aet_v_end[NUMSTACKEDGES];     // last scanline this edge i
 static int aet_order[NUMSTACKEDGES];                // sorted indices into pool arrays
 static int sort_keys[NUMSTACKEDGES];                // cached u values in sorted order
 static int aet_count;                                // number of active edges
+static int aet_tmp_order[NUMSTACKEDGES];            // merge scratch for R_SortActive_Merge
+static int aet_tmp_keys[NUMSTACKEDGES];
 static int aet_alloc;                                // next free pool slot (monotonic within frame)
 
 // Store v_end in edge_t->prev (unused by array-based AET, same cache line as u/surfs)
@@ -719,7 +721,7 @@ R_InsertNewEdges_Array
 Merge sorted newedges linked list into sorted aet[] array.
 ==============
 */
-PQ_FASTTEXT void R_InsertNewEdges_Array (edge_t *edgestoadd)
+PQ_HOTTEXT void R_InsertNewEdges_Array (edge_t *edgestoadd)
 {
 	edge_t *rev, *next;
 	int new_count, first_new, i, k, n;
@@ -784,7 +786,7 @@ R_RemoveEdges_Array
 Compact out entries whose v_end == current scanline.
 ==============
 */
-PQ_FASTTEXT void R_RemoveEdges_Array (int iv)
+PQ_HOTTEXT void R_RemoveEdges_Array (int iv)
 {
 	int i, j;
 
@@ -801,16 +803,85 @@ PQ_FASTTEXT void R_RemoveEdges_Array (int iv)
 }
 
 
+/*
+==============
+R_SortActive_Merge
+
+Natural merge sort of sort_keys[]/aet_order[].  Used when the per-scanline
+insertion sort runs out of shift budget: at silhouettes many edges cross
+on the same line and insertion sort goes quadratic, while the table is
+still made of a few long ascending runs that merge in O(n log runs).
+==============
+*/
+PQ_HOTTEXT static void R_SortActive_Merge (void)
+{
+	int		*skeys, *sorder, *dkeys, *dorder, *t;
+	int		n, lo, mid, hi, a, b, k, runs;
+
+	n = aet_count;
+	skeys = sort_keys;
+	sorder = aet_order;
+	dkeys = aet_tmp_keys;
+	dorder = aet_tmp_order;
+
+	do
+	{
+		runs = 0;
+		for (lo = 0 ; lo < n ; lo = hi)
+		{
+		// find two adjacent ascending runs [lo,mid) and [mid,hi)
+			for (mid = lo + 1 ; mid < n && skeys[mid-1] <= skeys[mid] ; mid++)
+				;
+			if (mid < n)
+				for (hi = mid + 1 ; hi < n && skeys[hi-1] <= skeys[hi] ; hi++)
+					;
+			else
+				hi = n;
+			runs++;
+
+			a = lo;
+			b = mid;
+			for (k = lo ; k < hi ; k++)
+			{
+				if (b >= hi || (a < mid && skeys[a] <= skeys[b]))
+				{
+					dkeys[k] = skeys[a];
+					dorder[k] = sorder[a++];
+				}
+				else
+				{
+					dkeys[k] = skeys[b];
+					dorder[k] = sorder[b++];
+				}
+			}
+		}
+
+		t = skeys; skeys = dkeys; dkeys = t;
+		t = sorder; sorder = dorder; dorder = t;
+	} while (runs > 1);
+
+	if (skeys != sort_keys)
+	{
+		memcpy (sort_keys, skeys, n * sizeof(int));
+		memcpy (aet_order, sorder, n * sizeof(int));
+	}
+}
+
+
 /*
 ==============
 R_StepActiveU_Array
 
-Step all u values, then insertion sort (nearly sorted -> ~O(n)).
+Step all u values, then insertion sort (nearly sorted -> ~O(n)).  If the
+line has too many crossings the sort hands off to R_SortActive_Merge.
 ==============
 */
+#define AET_SHIFT_BUDGET(n)	((n) * 2 + 32)	// element moves before merging
+
 unsigned int pq_prof_aet_step_max;  // max aet_count seen during Step
+unsigned int pq_prof_aet_merges;    // scanlines that fell back to merging
 
-PQ_FASTTEXT void R_StepActiveU_Array (void)
+PQ_HOTTEXT void R_StepActiveU_Array (void)
 {
 	int i;
 
@@ -851,20 +922,34 @@ PQ_FASTTEXT void R_StepActiveU_Array (void)
 	// The inner loop compare is now a single sequential load instead
 	// of two dependent loads, saving 3-4 cycles per comparison on
 	// VexiiRiscv's single-issue in-order pipeline.
-	for (i = 1; i < aet_count; i++)
+	// The shift count is bounded so a scanline full of crossing edges
+	// costs O(n log n) instead of O(n^2).
 	{
-		int key = sort_keys[i];
-		if (key < sort_keys[i-1])
+		int budget = AET_SHIFT_BUDGET(aet_count);
+
+		for (i = 1; i < aet_count; i++)
 		{
-			int idx = aet_order[i];
-			int j = i - 1;
-			do {
-				sort_keys[j+1] = sort_keys[j];
-				aet_order[j+1] = aet_order[j];
-				j--;
-			} while (j >= 0 && sort_keys[j] > key);
-			sort_keys[j+1] = key;
-			aet_order[j+1] = idx;
+			int key = sort_keys[i];
+			if (key < sort_keys[i-1])
+			{
+				int idx = aet_order[i];
+				int j = i - 1;
+				do {
+					sort_keys[j+1] = sort_keys[j];
+					aet_order[j+1] = aet_order[j];
+					j--;
+				} while (j >= 0 && sort_keys[j] > key);
+				sort_keys[j+1] = key;
+				aet_order[j+1] = idx;
+
+				budget -= i - 1 - j;
+				if (budget < 0)
+				{
+					pq_prof_aet_merges++;
+					R_SortActive_Merge ();
+					return;
+				}
+			}
 		}
 	}
 }
@@ -877,7 +962,7 @@ R_TrailingEdge_A
 Array variant: takes surface pointer and u value directly.
 ==============
 */
-PQ_FASTTEXT void R_TrailingEdge_A (surf_t *surf, int u)
+PQ_HOTTEXT void R_TrailingEdge_A (surf_t *surf, int u)
 {
 	espan_t		*span;
 	int			iu;
@@ -923,7 +1008,7 @@ Array variant: takes surface index and u value directly.
 // Precomputed constant for fixed-point to float conversion in depth tests
 static const float inv_0x100000 = 1.0f / (float)0x100000;
 
-PQ_FASTTEXT void R_LeadingEdge_A (int surf_idx, int u)
+PQ_HOTTEXT void R_LeadingEdge_A (int surf_idx, int u)
 {
 	espan_t		*span;
 	surf_t		*surf, *surf2;
@@ -1043,7 +1128,7 @@ R_LeadingEdgeBackwards_A
 Array variant: takes surface index and u value directly.
 ==============
 */
-PQ_FASTTEXT void R_LeadingEdgeBackwards_A (int surf_idx, int u)
+PQ_HOTTEXT void R_LeadingEdgeBackwards_A (int surf_idx, int u)
 {
 	espan_t		*span;
 	surf_t		*surf, *surf2;
@@ -1194,7 +1279,7 @@ R_GenerateSpans_Array
 Walk sorted aet[] array instead of linked list.
 ==============
 */
-PQ_FASTTEXT void R_GenerateSpans_Array (void)
+PQ_HOTTEXT void R_GenerateSpans_Array (void)
 {
 	int i;
 
@@ -1231,7 +1316,7 @@ R_GenerateSpansBackward_Array
 Walk sorted aet[] array instead of linked list (backward variant).
 ==============
 */
-PQ_FASTTEXT void R_GenerateSpansBackward_Array (void)
+PQ_HOTTEXT void R_GenerateSpansBackward_Array (void)
 {
 	int i;
 
@@ -1271,7 +1356,7 @@ Each surface has a linked list of its visible spans
 ==============
 */
 
-PQ_FASTTEXT void R_ScanEdges (void)
+PQ_HOTTEXT void R_ScanEdges (void)
 {
 	int		iv, bottom;
 	static byte	basespans[MAXSPANS*sizeof(espan_t)+CACHE_SIZE];
@@ -0,0 +1,295 @@
+/*
+Copyright (C) 1996-1997 Id Software, Inc.
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// r_govern.c -- frame-time governor
+//
+// Holds a target frame rate by walking a ladder of quality knobs.  Each
+// knob moves one step at a time from the user's setting toward a limit;
+// knobs are given up in ladder order and restored in reverse, so the
+// cheapest-looking savings go first and come back last.
+
+#include "quakedef.h"
+#include "r_local.h"
+
+cvar_t	r_govern = {"r_govern", "0"};				// target fps, 0 = off
+cvar_t	r_govern_show = {"r_govern_show", "0"};
+cvar_t	r_govern_log = {"r_govern_log", "0"};
+// most degraded value each knob may reach
+cvar_t	r_govern_particles = {"r_govern_particles", "0"};
+cvar_t	r_govern_dynamic = {"r_govern_dynamic", "0"};
+cvar_t	r_govern_mipscale = {"r_govern_mipscale", "1"};
+cvar_t	r_govern_cullsize = {"r_govern_cullsize", "6"};
+cvar_t	r_govern_mipcap = {"r_govern_mipcap", "2"};
+cvar_t	r_govern_viewmodel = {"r_govern_viewmodel", "0"};
+
+extern cvar_t	r_drawparticles;
+extern cvar_t	r_drawviewmodel;
+extern cvar_t	d_mipcap;
+extern cvar_t	d_mipscale;
+
+typedef struct
+{
+	cvar_t	*var;
+	cvar_t	*limit;
+	float	step;		// magnitude of one move
+	float	base;		// user's setting, restored when the load drops
+	float	cur;		// value the governor last wrote
+} govknob_t;
+
+static govknob_t	gov_knobs[] =
+{
+	{&r_drawparticles,	&r_govern_particles,	1},
+	{&r_dynamic,		&r_govern_dynamic,		1},
+	{&d_mipscale,		&r_govern_mipscale,		0.2f},
+	{&r_cullsize,		&r_govern_cullsize,		1},
+	{&d_mipcap,			&r_govern_mipcap,		1},
+	{&r_drawviewmodel,	&r_govern_viewmodel,	1},
+};
+
+#define NUM_GOVKNOBS	(sizeof(gov_knobs)/sizeof(gov_knobs[0]))
+
+#define GOV_DEGRADE_HOLD	10		// frames to settle after giving up quality
+#define GOV_RESTORE_HOLD	30		// restoring is slower so it does not ping-pong
+#define GOV_HITCH_MS		250		// ignore load stalls and the like
+
+static qboolean	gov_active;
+static float	gov_avgms;
+static int		gov_hold;
+static int		gov_lastknob = -1;
+
+void R_InitGovernor (void)
+{
+	Cvar_RegisterVariable (&r_govern);
+	Cvar_RegisterVariable (&r_govern_show);
+	Cvar_RegisterVariable (&r_govern_log);
+	Cvar_RegisterVariable (&r_govern_particles);
+	Cvar_RegisterVariable (&r_govern_dynamic);
+	Cvar_RegisterVariable (&r_govern_mipscale);
+	Cvar_RegisterVariable (&r_govern_cullsize);
+	Cvar_RegisterVariable (&r_govern_mipcap);
+	Cvar_RegisterVariable (&r_govern_viewmodel);
+}
+
+/*
+================
+R_GovernSet
+================
+*/
+static void R_GovernSet (govknob_t *k, float value)
+{
+	if (k->var->value != value)
+		Cvar_SetValue (k->var->name, value);
+	k->cur = k->var->value;		// as the cvar parsed it, for the compare below
+
+	if (r_govern_log.value)
+		Con_Printf ("govern: %s %.1f (avg %.1f ms)\n", k->var->name, value,
+				gov_avgms);
+}
+
+/*
+================
+R_GovernStart / R_GovernStop
+================
+*/
+static void R_GovernStart (void)
+{
+	int		i;
+
+	for (i=0 ; i<NUM_GOVKNOBS ; i++)
+		gov_knobs[i].base = gov_knobs[i].cur = gov_knobs[i].var->value;
+	gov_avgms = 1000.0f / r_govern.value;
+	gov_hold = GOV_DEGRADE_HOLD;
+	gov_lastknob = -1;
+	gov_active = true;
+}
+
+static void R_GovernStop (void)
+{
+	int			i;
+	govknob_t	*k;
+
+	for (i=0, k=gov_knobs ; i<NUM_GOVKNOBS ; i++, k++)
+		if (k->cur != k->base)
+			R_GovernSet (k, k->base);
+	gov_lastknob = -1;
+	gov_active = false;
+}
+
+/*
+================
+R_GovernDegrade
+
+Moves the first knob that still has room one step toward its limit.
+================
+*/
+static qboolean R_GovernDegrade (void)
+{
+	int			i;
+	float		v, limit;
+	govknob_t	*k;
+
+	for (i=0, k=gov_knobs ; i<NUM_GOVKNOBS ; i++, k++)
+	{
+		limit = k->limit->value;
+		if (fabs(k->cur - limit) < 0.01f)
+			continue;
+		if (limit > k->cur)
+		{
+			v = k->cur + k->step;
+			if (v > limit)
+				v = limit;
+		}
+		else
+		{
+			v = k->cur - k->step;
+			if (v < limit)
+				v = limit;
+		}
+		R_GovernSet (k, v);
+		gov_lastknob = i;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+================
+R_GovernRestore
+
+Moves the last knob that is off its base one step back.
+================
+*/
+static qboolean R_GovernRestore (void)
+{
+	int			i;
+	float		v;
+	govknob_t	*k;
+
+	for (i=NUM_GOVKNOBS-1, k=gov_knobs+i ; i>=0 ; i--, k--)
+	{
+		if (fabs(k->cur - k->base) < 0.01f)
+			continue;
+		if (k->base > k->cur)
+		{
+			v = k->cur + k->step;
+			if (v > k->base)
+				v = k->base;
+		}
+		else
+		{
+			v = k->cur - k->step;
+			if (v < k->base)
+				v = k->base;
+		}
+		R_GovernSet (k, v);
+
+	// the overlay names the last knob still given up, if any
+		for ( ; i>=0 ; i--, k--)
+			if (fabs(k->cur - k->base) >= 0.01f)
+				break;
+		gov_lastknob = i;
+		return true;
+	}
+
+	return false;
+}
+
+/*
+================
+R_GovernFrame
+
+Called once per view with r_framems holding the last frame interval.
+Degrades above 105% of the budget and restores below 85%; the gap plus the
+hold times keep one knob from flipping back and forth.
+================
+*/
+void R_GovernFrame (void)
+{
+	int			i;
+	float		budget;
+	govknob_t	*k;
+
+	if (r_govern.value <= 0)
+	{
+		if (gov_active)
+			R_GovernStop ();
+		return;
+	}
+
+	if (!gov_active)
+		R_GovernStart ();
+
+// a knob changed from the console becomes the new base setting
+	for (i=0, k=gov_knobs ; i<NUM_GOVKNOBS ; i++, k++)
+		if (k->var->value != k->cur)
+			k->base = k->cur = k->var->value;
+
+	if (r_framems > GOV_HITCH_MS || cl.paused || key_dest != key_game)
+		return;
+
+	gov_avgms += (r_framems - gov_avgms) * 0.1f;
+
+	if (gov_hold > 0)
+	{
+		gov_hold--;
+		return;
+	}
+
+	budget = 1000.0f / r_govern.value;
+	if (gov_avgms > budget * 1.05f)
+	{
+		if (R_GovernDegrade ())
+			gov_hold = GOV_DEGRADE_HOLD;
+	}
+	else if (gov_avgms < budget * 0.85f)
+	{
+		if (R_GovernRestore ())
+			gov_hold = GOV_RESTORE_HOLD;
+	}
+}
+
+/*
+================
+R_DrawGovernor
+
+Frame time against the budget, plus the knob the governor is working on
+================
+*/
+void R_DrawGovernor (void)
+{
+	char		str[40];
+	govknob_t	*k;
+
+	if (!r_govern_show.value || !gov_active)
+		return;
+
+	snprintf (str, sizeof(str), "%.1f/%.1fms", gov_avgms,
+			1000.0f / r_govern.value);
+	Draw_String (vid.width - (int)strlen(str)*8, 0, str);
+
+	if (gov_lastknob < 0)
+		strcpy (str, "full quality");
+	else
+	{
+		k = &gov_knobs[gov_lastknob];
+		snprintf (str, sizeof(str), "%s %.1f", k->var->name, k->cur);
+	}
+	Draw_String (vid.width - (int)strlen(str)*8, 8, str);
+}
@@ -144,6 +144,9 @@ LIGHT SAMPLING
 =============================================================================
 */
 
+static msurface_t	*lightsurf;		// RecursiveLightPoint hit
+static byte			*lightsample;
+
 int RecursiveLightPoint (mnode_t *node, vec3_t start, vec3_t end)
 {
 	int			r;
@@ -209,6 +212,9 @@ int RecursiveLightPoint (mnode_t *node, vec3_t start, vec3_t end)
 		if ( ds > surf->extents[0] || dt > surf->extents[1] )
 			continue;
 
+		lightsurf = surf;
+		lightsample = NULL;
+
 		if (!surf->samples)
 			return 0;
 
@@ -221,6 +227,7 @@ int RecursiveLightPoint (mnode_t *node, vec3_t start, vec3_t end)
 		{
 
 			lightmap += dt * ((surf->extents[0]>>4)+1) + ds;
+			lightsample = lightmap;
 
 			for (maps = 0 ; maps < MAXLIGHTMAPS && surf->styles[maps] != 255 ;
 					maps++)
@@ -263,3 +270,116 @@ int R_LightPoint (vec3_t p)
 
 	return r;
 }
+
+/*
+==============================================================================
+
+ENTITY LIGHT CACHE
+
+Most entities hold still from frame to frame, and the floor texel under
+them stays the same until they move a whole unit.  R_LightPointCached
+remembers which lightmap texel the last trace landed on and re-weights
+it with the current style values, so animated lights still come through
+and the BSP descent only runs when the entity moves.
+
+==============================================================================
+*/
+
+cvar_t	r_lightcache = {"r_lightcache", "1"};
+
+int		r_lightgen = 1;			// bumped when the world changes
+int		r_lightcache_hits, r_lightcache_misses;
+
+/*
+=============
+R_InvalidateLightCache
+=============
+*/
+void R_InvalidateLightCache (void)
+{
+	r_lightgen++;
+}
+
+/*
+=============
+R_LightSample
+
+Weights a cached lightmap texel by the current light styles
+=============
+*/
+static int R_LightSample (msurface_t *surf, byte *lightmap)
+{
+	int			maps, r;
+	int			size;
+
+	r = 0;
+	size = ((surf->extents[0]>>4)+1) * ((surf->extents[1]>>4)+1);
+
+	for (maps = 0 ; maps < MAXLIGHTMAPS && surf->styles[maps] != 255 ;
+			maps++)
+	{
+		r += *lightmap * d_lightstylevalue[surf->styles[maps]];
+		lightmap += size;
+	}
+
+	return r >> 8;
+}
+
+/*
+=============
+R_LightPointCached
+=============
+*/
+int R_LightPointCached (vec3_t p, entlight_t *cache)
+{
+	vec3_t		end;
+	int			key[3];
+	int			r;
+
+	if (!cl.worldmodel->lightdata)
+		return 255;
+
+	if (!r_lightcache.value)
+		return R_LightPoint (p);
+
+	key[0] = (int)floor (p[0]);
+	key[1] = (int)floor (p[1]);
+	key[2] = (int)floor (p[2]);
+
+	if (cache->gen == r_lightgen && cache->key[0] == key[0] &&
+		cache->key[1] == key[1] && cache->key[2] == key[2])
+	{
+		r_lightcache_hits++;
+
+		if (!cache->surf || !cache->sample)
+			r = 0;
+		else
+			r = R_LightSample (cache->surf, cache->sample);
+	}
+	else
+	{
+		r_lightcache_misses++;
+
+		end[0] = p[0];
+		end[1] = p[1];
+		end[2] = p[2] - 2048;
+
+		lightsurf = NULL;
+		lightsample = NULL;
+		r = RecursiveLightPoint (cl.worldmodel->nodes, p, end);
+		if (r == -1)
+			r = 0;
+
+		cache->key[0] = key[0];
+		cache->key[1] = key[1];
+		cache->key[2] = key[2];
+		cache->gen = r_lightgen;
+		cache->surf = lightsurf;
+		cache->sample = lightsample;
+	}
+
+	if (r < r_refdef.ambientlight)
+		r = r_refdef.ambientlight;
+
+	return r;
+}
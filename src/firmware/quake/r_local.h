@@ -75,6 +75,11 @@ extern cvar_t	r_reportedgeout;
 extern cvar_t	r_maxedges;
 extern cvar_t	r_numedges;
 
+extern float	r_framems;
+
+void R_InitGovernor (void);
+void R_GovernFrame (void);
+
 #define XCENTERING	(1.0 / 2.0)
 #define YCENTERING	(1.0 / 2.0)
 
@@ -138,6 +143,8 @@ void R_RenderPoly (msurface_t *fa, int clipflags);
 void R_RenderBmodelFace (bedge_t *pedges, msurface_t *psurf);
 void R_TransformPlane (mplane_t *p, float *normal, float *dist);
 void R_TransformFrustum (void);
+void R_SetUpFixedFrustum (void);
+int R_CullBoxes (short **boxes, int count, int clipflags, int *outflags);
 void R_SetSkyFrame (void);
 void R_DrawSurfaceBlock16 (void);
 void R_DrawSurfaceBlock8 (void);
@@ -280,6 +287,14 @@ extern int		r_outofsurfaces;
 extern int		r_outofedges;
 
 extern mvertex_t	*r_pcurrentvertbase;
+
+extern cvar_t	r_vertcache;
+void R_InitVertCache (void);
+void R_NewVertCacheView (void);
+
+extern cvar_t	r_edgereuse;
+void R_InitWorldEdgeCache (void);
+void R_InvalidateWorldEdges (void);
 extern int			r_maxvalidedgeoffset;
 
 void R_AliasClipTriangle (mtriangle_t *ptri);
@@ -309,6 +324,11 @@ void R_PrintTimes (void);
 void R_PrintDSpeeds (void);
 void R_AnimateLight (void);
 int R_LightPoint (vec3_t p);
+
+extern cvar_t	r_lightcache;
+extern int		r_lightcache_hits, r_lightcache_misses;
+int R_LightPointCached (vec3_t p, entlight_t *cache);
+void R_InvalidateLightCache (void);
 void R_SetupFrame (void);
 void R_cshift_f (void);
 void R_EmitEdge (mvertex_t *pv0, mvertex_t *pv1);
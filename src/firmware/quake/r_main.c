@@ -134,6 +134,7 @@ extern unsigned int pq_prof_aet_peak;
 extern unsigned int pq_prof_aet_peak_scanline;
 extern unsigned int pq_prof_aet_total_edges;
 extern unsigned int pq_prof_aet_step_max;
+extern unsigned int pq_prof_aet_merges;
 extern unsigned int pq_prof_hw_spans_total;
 extern unsigned int pq_prof_hw_spans_linked;
 extern unsigned int pq_dbg_hw_nspans;
@@ -183,6 +184,7 @@ static unsigned int pq_prof_aet_peak_accum;
 static unsigned int pq_prof_aet_peak_scanline_accum;
 static unsigned int pq_prof_aet_total_accum;
 static unsigned int pq_prof_aet_step_max_accum;
+static unsigned int pq_prof_aet_merges_accum;
 static unsigned int pq_prof_hw_spans_total_accum;
 static unsigned int pq_prof_hw_spans_linked_accum;
 static unsigned int pq_prof_ds_calcgrad_accum;
@@ -212,6 +214,7 @@ static unsigned int pq_prof_avg_aet_peak;
 static unsigned int pq_prof_avg_aet_peak_scanline;
 static unsigned int pq_prof_avg_aet_total;
 static unsigned int pq_prof_avg_aet_step_max;
+static unsigned int pq_prof_avg_aet_merges;
 static unsigned int pq_prof_avg_hw_spans_total;
 static unsigned int pq_prof_avg_hw_spans_linked;
 static unsigned int pq_prof_avg_ds_calcgrad;
@@ -230,6 +233,7 @@ static unsigned int pq_hw_snap_sdram_dma;
 static unsigned int pq_hw_snap_sdram_cpu;
 static unsigned int pq_hw_snap_span_fifo_full;
 static unsigned int pq_hw_snap_cpu_contention;
+static unsigned int pq_hw_snap_icache_stall;
 
 /* HW perf: per-frame deltas */
 static unsigned int pq_hw_span_frame;
@@ -245,6 +249,7 @@ static unsigned int pq_hw_cache_misses_frame;
 static unsigned int pq_hw_pixels_frame;
 static unsigned int pq_hw_span_fifo_full_frame;
 static unsigned int pq_hw_cpu_contention_frame;
+static unsigned int pq_hw_icache_stall_frame;
 
 /* HW perf: 64-frame accumulators */
 static unsigned int pq_hw_span_accum;
@@ -260,6 +265,7 @@ static unsigned int pq_hw_cache_misses_accum;
 static unsigned int pq_hw_pixels_accum;
 static unsigned int pq_hw_span_fifo_full_accum;
 static unsigned int pq_hw_cpu_contention_accum;
+static unsigned int pq_hw_icache_stall_accum;
 
 /* HW perf: averaged values */
 static unsigned int pq_hw_avg_span;
@@ -275,6 +281,7 @@ static unsigned int pq_hw_avg_cache_misses;
 static unsigned int pq_hw_avg_pixels;
 static unsigned int pq_hw_avg_span_fifo_full;
 static unsigned int pq_hw_avg_cpu_contention;
+static unsigned int pq_hw_avg_icache_stall;
 
 /* Mode tracking for display mode transitions */
 static int pq_prof_prev_mode;
@@ -309,6 +316,19 @@ cvar_t	r_numedges = {"r_numedges", "0"};
 cvar_t	r_aliastransbase = {"r_aliastransbase", "200"};
 cvar_t	r_aliastransadj = {"r_aliastransadj", "100"};
 cvar_t	pq_cycleprof = {"pq_cycleprof", "0"};
+cvar_t	r_dynres = {"r_dynres", "0"};
+cvar_t	r_dynres_ms = {"r_dynres_ms", "33"};		// target frame time
+cvar_t	r_dynres_min = {"r_dynres_min", "0.5"};	// smallest view scale
+cvar_t	r_dynres_filter = {"r_dynres_filter", "1"};	// 2-tap upscale at scanout
+
+//
+// dynamic resolution
+//
+float		r_dynres_scale = 1;		// controller state, adapted to frame time
+float		r_dynres_cur = 1;		// scale the current vrect was built with
+float		r_dynres_avgms;
+float		r_framems;			// interval between the last two views
+vrect_t		r_dynres_fullvrect;		// view rect as seen on screen
 
 extern cvar_t	scr_fov;
 
@@ -395,6 +415,15 @@ void R_Init (void)
 	Cvar_RegisterVariable (&r_aliastransbase);
 	Cvar_RegisterVariable (&r_aliastransadj);
 	Cvar_RegisterVariable (&pq_cycleprof);
+	Cvar_RegisterVariable (&r_dynres);
+	Cvar_RegisterVariable (&r_dynres_ms);
+	Cvar_RegisterVariable (&r_dynres_min);
+	Cvar_RegisterVariable (&r_dynres_filter);
+	Cvar_RegisterVariable (&r_vertcache);
+	Cvar_RegisterVariable (&r_edgereuse);
+	Cvar_RegisterVariable (&r_lightcache);
+
+	R_InitGovernor ();
 
 	Cvar_SetValue ("r_maxedges", (float)NUMSTACKEDGES);
 	Cvar_SetValue ("r_maxsurfs", (float)NUMSTACKSURFACES);
@@ -436,6 +465,8 @@ void R_NewMap (void)
 
 	r_viewleaf = NULL;
 	R_ClearParticles ();
+	R_InitVertCache ();
+	R_InvalidateLightCache ();
 
 	r_cnumsurfs = r_maxsurfs.value;
 
@@ -476,6 +507,8 @@ void R_NewMap (void)
 								   "edges");
 	}
 
+	R_InitWorldEdgeCache ();
+
 	r_dowarpold = false;
 	r_viewchanged = false;
 #ifdef PASSAGES
@@ -543,9 +576,26 @@ void R_ViewChanged (vrect_t *pvrect, int lineadj, float aspect)
 	float	res_scale;
 
 	r_viewchanged = true;
+	R_InvalidateWorldEdges ();
 
 	R_SetVrect (pvrect, &r_refdef.vrect, lineadj);
 
+// dynamic resolution renders into the top left of the view rect and lets
+// scanout stretch it back; keep the on-screen aspect by adjusting the
+// pixel aspect for the rounding of each axis
+	r_dynres_fullvrect = r_refdef.vrect;
+	if (r_dynres_cur < 1)
+	{
+		r_refdef.vrect.width = (int)(r_refdef.vrect.width * r_dynres_cur) & ~7;
+		r_refdef.vrect.height = (int)(r_refdef.vrect.height * r_dynres_cur) & ~1;
+		if (r_refdef.vrect.width < 64)
+			r_refdef.vrect.width = 64;
+		if (r_refdef.vrect.height < 48)
+			r_refdef.vrect.height = 48;
+		aspect *= ((float)r_dynres_fullvrect.width / r_refdef.vrect.width) *
+				((float)r_refdef.vrect.height / r_dynres_fullvrect.height);
+	}
+
 	r_refdef.horizontalFieldOfView = 2.0f * tanf (r_refdef.fov_x/360*M_PI);
 	r_refdef.fvrectx = (float)r_refdef.vrect.x;
 	r_refdef.fvrectx_adj = (float)r_refdef.vrect.x - 0.5;
@@ -742,7 +792,8 @@ PQ_FASTTEXT void R_DrawEntitiesOnList (void)
 		// trivial accept status
 			if (R_AliasCheckBBox ())
 			{
-				j = R_LightPoint (currententity->origin);
+				j = R_LightPointCached (currententity->origin,
+						&currententity->light);
 	
 				lighting.ambientlight = j;
 				lighting.shadelight = j;
@@ -826,7 +877,7 @@ void R_DrawViewModel (void)
 	VectorCopy (vup, viewlightvec);
 	VectorInverse (viewlightvec);
 
-	j = R_LightPoint (currententity->origin);
+	j = R_LightPointCached (currententity->origin, &currententity->light);
 
 	if (j < 24)
 		j = 24;		// allways give some light on gun
@@ -993,6 +1044,7 @@ void R_DrawBEntitiesOnList (void)
 		
 			// FIXME: stop transforming twice
 				R_RotateBmodel ();
+				R_NewVertCacheView ();
 
 			// calculate dynamic lighting for bmodel if it's not an
 			// instanced model
@@ -1150,9 +1202,10 @@ static void PQ_Prof_DrawTerminal(void)
 	term_setpos(row++, 0);
 	{
 		int leaf0 = (r_viewleaf == cl.worldmodel->leafs) ? 1 : 0;
-		snprintf(line, sizeof(line), "AET:%u/%u fc:%d poly:%d L0:%d",
+		snprintf(line, sizeof(line), "AET:%u/%u m:%u fc:%d poly:%d L0:%d",
 			pq_prof_avg_aet_peak,
 			pq_prof_avg_aet_total,
+			pq_prof_avg_aet_merges,
 			c_faceclip,
 			r_polycount,
 			leaf0);
@@ -1188,18 +1241,103 @@ static void PQ_Prof_DrawTerminal(void)
 	HW_ROW("CPU contend:",pq_hw_avg_cpu_contention);
 #undef HW_ROW
 
-	/* FPS estimate */
+	/* FPS estimate, plus I-fetch refill stalls (no rows left for their own) */
 	unsigned int total_ms = pq_prof_avg_total / 100000;
+	p = pct10(pq_hw_avg_icache_stall, pq_prof_avg_total);
 	term_setpos(row++, 0);
 	if (total_ms > 0)
-		snprintf(line, sizeof(line), "~%u FPS (%u.%u ms)",
+		snprintf(line, sizeof(line), "~%u FPS (%u.%u ms) I$ %u.%u%%",
 			1000 / total_ms, total_ms,
-			(pq_prof_avg_total / 10000) % 10);
+			(pq_prof_avg_total / 10000) % 10, p / 10, p % 10);
 	else
-		snprintf(line, sizeof(line), "~999+ FPS");
+		snprintf(line, sizeof(line), "~999+ FPS I$ %u.%u%%", p / 10, p % 10);
 	term_puts(line);
 }
 
+/*
+================
+R_MeasureFrame
+
+Time since the previous R_RenderView, for the frame-time controllers
+================
+*/
+static void R_MeasureFrame (void)
+{
+	static unsigned int	last_cycles;
+	unsigned int		now;
+
+	now = SYS_CYCLE_LO;
+	r_framems = (now - last_cycles) / 100000.0f;	// 100 MHz cycle counter
+	last_cycles = now;
+}
+
+/*
+================
+R_DynResAdjust
+
+Picks the view scale for this frame from recent frame times.  Shrinks fast
+when over budget, grows slowly when well under it, and holds for a few frames
+after every change so the average reflects the new size.
+================
+*/
+#define DYNRES_STEP		(1.0f / 16)
+#define DYNRES_HOLD		8
+
+static void R_DynResAdjust (void)
+{
+	static int			hold;
+	float				ms, target, scale, minscale;
+
+	ms = r_framems;
+
+	if (!r_dynres.value || r_dowarp || lcd_x.value)
+	{
+		r_dynres_scale = 1;
+		r_dynres_avgms = 0;
+		scale = 1;
+	}
+	else
+	{
+		scale = r_dynres_scale;
+		if (!scr_viewoverlay && ms < 250)	// skip loading hitches
+		{
+			r_dynres_avgms += (ms - r_dynres_avgms) * 0.25f;
+			target = r_dynres_ms.value;
+			minscale = r_dynres_min.value;
+			if (minscale < 0.25f)
+				minscale = 0.25f;
+
+			if (hold > 0)
+				hold--;
+			else if (r_dynres_avgms > target * 1.05f && scale > minscale)
+			{
+				scale -= DYNRES_STEP;
+				hold = DYNRES_HOLD;
+			}
+			else if (r_dynres_avgms < target * 0.8f && scale < 1)
+			{
+				scale += DYNRES_STEP / 2;
+				hold = DYNRES_HOLD * 2;
+			}
+			if (scale < minscale)
+				scale = minscale;
+			if (scale > 1)
+				scale = 1;
+			r_dynres_scale = scale;
+		}
+
+	// 2D over the view would be stretched too, so draw those frames native
+		if (scr_viewoverlay)
+			scale = 1;
+	}
+
+	if (scale != r_dynres_cur)
+	{
+		r_dynres_cur = scale;
+		r_viewchanged = true;	// R_SetupFrame rebuilds the vrect
+	}
+}
+
 /*
 ================
 R_EdgeDrawing
@@ -1344,6 +1482,7 @@ void R_RenderView_ (void)
 		pq_hw_snap_sdram_cpu = SYS_PERF_SDRAM_CPU;
 		pq_hw_snap_span_fifo_full = SYS_PERF_SPAN_FIFO_FULL;
 		pq_hw_snap_cpu_contention = SYS_PERF_CPU_CONTENTION;
+		pq_hw_snap_icache_stall = SYS_PERF_ICACHE_STALL;
 		/* Write-clear span event counters */
 		SPAN_PERF_CACHE_HITS = 0;
 	}
@@ -1351,6 +1490,10 @@ void R_RenderView_ (void)
 	if (r_timegraph.value || r_speeds.value || r_dspeeds.value)
 		r_time1 = Sys_FloatTime ();
 
+	R_MeasureFrame ();
+	R_GovernFrame ();
+	R_DynResAdjust ();
+	IN_LateLook ();
 	R_SetupFrame ();
 	pq_dbg_stage = 0x3201;
 
@@ -1452,6 +1595,10 @@ SetVisibilityByPassages ();
 		D_WarpScreen ();
 	pq_dbg_stage = 0x320F;
 
+	if (r_dynres_cur < 1)
+		VID_SetViewScale (&r_dynres_fullvrect, r_refdef.vrect.width,
+				r_refdef.vrect.height, (int)r_dynres_filter.value);
+
 	if (profiling) {
 		pq_prof_total_cycles_frame = SYS_CYCLE_LO - pq_prof_total_cycles_frame;
 
@@ -1466,6 +1613,7 @@ SetVisibilityByPassages ();
 		pq_hw_sdram_cpu_frame = SYS_PERF_SDRAM_CPU - pq_hw_snap_sdram_cpu;
 		pq_hw_span_fifo_full_frame = SYS_PERF_SPAN_FIFO_FULL - pq_hw_snap_span_fifo_full;
 		pq_hw_cpu_contention_frame = SYS_PERF_CPU_CONTENTION - pq_hw_snap_cpu_contention;
+		pq_hw_icache_stall_frame = SYS_PERF_ICACHE_STALL - pq_hw_snap_icache_stall;
 		/* Span event counters (cleared at frame start) */
 		pq_hw_cache_hits_frame   = SPAN_PERF_CACHE_HITS;
 		pq_hw_cache_misses_frame = SPAN_PERF_CACHE_MISSES;
@@ -1533,6 +1681,8 @@ SetVisibilityByPassages ();
 			if (pq_prof_aet_step_max > pq_prof_aet_step_max_accum)
 				pq_prof_aet_step_max_accum = pq_prof_aet_step_max;
 			pq_prof_aet_step_max = 0;  // reset per-frame
+			pq_prof_aet_merges_accum += pq_prof_aet_merges;
+			pq_prof_aet_merges = 0;  // reset per-frame
 			pq_prof_hw_spans_total_accum += pq_prof_hw_spans_total;
 			pq_prof_hw_spans_linked_accum += pq_prof_hw_spans_linked;
 			pq_prof_ds_calcgrad_accum += pq_prof_ds_calcgrad_cycles;
@@ -1554,6 +1704,7 @@ SetVisibilityByPassages ();
 			pq_hw_pixels_accum += pq_hw_pixels_frame;
 			pq_hw_span_fifo_full_accum += pq_hw_span_fifo_full_frame;
 			pq_hw_cpu_contention_accum += pq_hw_cpu_contention_frame;
+			pq_hw_icache_stall_accum += pq_hw_icache_stall_frame;
 
 			if ((pq_prof_frame_counter & 63) == 0) {
 				pq_prof_avg_total = pq_prof_total_accum >> 6;
@@ -1577,6 +1728,7 @@ SetVisibilityByPassages ();
 				pq_prof_avg_aet_peak_scanline = pq_prof_aet_peak_scanline_accum;
 				pq_prof_avg_aet_total = pq_prof_aet_total_accum >> 6;
 				pq_prof_avg_aet_step_max = pq_prof_aet_step_max_accum;
+				pq_prof_avg_aet_merges = pq_prof_aet_merges_accum >> 6;
 				pq_prof_avg_hw_spans_total = pq_prof_hw_spans_total_accum >> 6;
 				pq_prof_avg_hw_spans_linked = pq_prof_hw_spans_linked_accum >> 6;
 				pq_prof_avg_ds_calcgrad = pq_prof_ds_calcgrad_accum >> 6;
@@ -1605,6 +1757,7 @@ SetVisibilityByPassages ();
 				pq_prof_aet_peak_scanline_accum = 0;
 				pq_prof_aet_total_accum = 0;
 				pq_prof_aet_step_max_accum = 0;
+				pq_prof_aet_merges_accum = 0;
 				pq_prof_hw_spans_total_accum = 0;
 				pq_prof_hw_spans_linked_accum = 0;
 				pq_prof_ds_calcgrad_accum = 0;
@@ -1626,6 +1779,7 @@ SetVisibilityByPassages ();
 				pq_hw_avg_pixels = pq_hw_pixels_accum >> 6;
 				pq_hw_avg_span_fifo_full = pq_hw_span_fifo_full_accum >> 6;
 				pq_hw_avg_cpu_contention = pq_hw_cpu_contention_accum >> 6;
+				pq_hw_avg_icache_stall = pq_hw_icache_stall_accum >> 6;
 
 				pq_hw_span_accum = 0;
 				pq_hw_dma_accum = 0;
@@ -1640,6 +1794,7 @@ SetVisibilityByPassages ();
 				pq_hw_pixels_accum = 0;
 				pq_hw_span_fifo_full_accum = 0;
 				pq_hw_cpu_contention_accum = 0;
+				pq_hw_icache_stall_accum = 0;
 
 				PQ_Prof_DrawTerminal();
 			}
@@ -1673,6 +1828,7 @@ SetVisibilityByPassages ();
 		pq_prof_aet_peak_scanline_accum = 0;
 		pq_prof_aet_total_accum = 0;
 		pq_prof_aet_step_max_accum = 0;
+		pq_prof_aet_merges_accum = 0;
 		pq_prof_hw_spans_total_accum = 0;
 		pq_prof_hw_spans_linked_accum = 0;
 		pq_prof_ds_calcgrad_accum = 0;
@@ -1723,6 +1879,8 @@ void R_RenderView (void)
 	if ( (long)(&r_warpbuffer) & 3 )
 		Sys_Error ("Globals are missaligned");
 
+	VID_LatencyMark (LAT_RENDER);
+
 	pq_dbg_stage = 0x3211;
 	R_RenderView_ ();
 	pq_dbg_stage = 0x3212;
@@ -238,7 +238,14 @@ R_PrintAliasStats
 */
 void R_PrintAliasStats (void)
 {
+	int		total;
+
 	Con_Printf ("%3i polygon model drawn\n", r_amodels_drawn);
+
+	total = r_lightcache_hits + r_lightcache_misses;
+	if (total)
+		Con_Printf ("%3i light samples, %3i%% cached\n", total,
+				r_lightcache_hits * 100 / total);
 }
 
 
@@ -356,6 +363,126 @@ void R_SetUpFrustumIndexes (void)
 		pfrustum_indexes[i] = pindex;
 		pindex += 6;
 	}
+
+	R_SetUpFixedFrustum ();
+}
+
+
+/*
+==============================================================================
+
+FIXED-POINT BOX CULLING
+
+Node and leaf bounds are shorts, so testing them against the frustum in
+float costs an int->float convert per corner component.  With the plane
+normals in 1.12 fixed point the test is three integer multiplies, and a
+whole list of boxes runs through one call.
+
+Rounding the normals moves the plane by at most slop, so a box is only
+rejected when it is slop clear of the plane and only unclipped when it
+is slop inside; the result never culls something the float test keeps.
+
+==============================================================================
+*/
+
+#define FRUSTUM_FRACBITS	12
+
+typedef struct
+{
+	int		normal[3];
+	int		dist;
+	int		slop;
+	int		*pindex;
+} fixedplane_t;
+
+static fixedplane_t	r_fixedfrustum[4];
+
+/*
+===============
+R_SetUpFixedFrustum
+
+Called whenever pfrustum_indexes is rebuilt for the world view
+===============
+*/
+void R_SetUpFixedFrustum (void)
+{
+	int				i, j;
+	float			err, scale;
+	clipplane_t		*cp;
+	fixedplane_t	*fp;
+
+	scale = 1 << FRUSTUM_FRACBITS;
+
+	for (i=0, cp=view_clipplanes, fp=r_fixedfrustum ; i<4 ; i++, cp++, fp++)
+	{
+		err = 0;
+		for (j=0 ; j<3 ; j++)
+		{
+			fp->normal[j] = (int)floor (cp->normal[j] * scale + 0.5f);
+			err += fabs (fp->normal[j] - cp->normal[j] * scale);
+		}
+		fp->dist = (int)floor (cp->dist * scale + 0.5f);
+
+	// worst case over any short coordinate, plus the dist rounding
+		fp->slop = (int)(err * 32768.0f) + 2;
+		fp->pindex = pfrustum_indexes[i];
+	}
+}
+
+/*
+===============
+R_CullBoxes
+
+Tests count short minmaxs boxes against the planes in clipflags.  Each
+outflags entry is -1 if that box is outside the frustum, otherwise the
+planes it still crosses.  Returns the number of boxes not culled.
+===============
+*/
+PQ_FASTTEXT int R_CullBoxes (short **boxes, int count, int clipflags,
+	int *outflags)
+{
+	int				i, b, flags, d, visible;
+	int				*pindex;
+	short			*mm;
+	fixedplane_t	*fp;
+
+	visible = 0;
+	for (b=0 ; b<count ; b++)
+	{
+		mm = boxes[b];
+		flags = clipflags;
+
+		for (i=0, fp=r_fixedfrustum ; i<4 ; i++, fp++)
+		{
+			if (!(flags & (1<<i)))
+				continue;
+
+			pindex = fp->pindex;
+
+			d = mm[pindex[0]] * fp->normal[0] +
+				mm[pindex[1]] * fp->normal[1] +
+				mm[pindex[2]] * fp->normal[2] - fp->dist;
+
+			if (d <= -fp->slop)
+			{
+				flags = -1;
+				break;
+			}
+
+			d = mm[pindex[3]] * fp->normal[0] +
+				mm[pindex[4]] * fp->normal[1] +
+				mm[pindex[5]] * fp->normal[2] - fp->dist;
+
+			if (d >= fp->slop)
+				flags &= ~(1<<i);
+		}
+
+		outflags[b] = flags;
+		if (flags >= 0)
+			visible++;
+	}
+
+	return visible;
 }
 
 
@@ -515,6 +642,8 @@ r_refdef.viewangles[2]=    0;
 	r_drawnpolycount = 0;
 	r_wholepolycount = 0;
 	r_amodels_drawn = 0;
+	r_lightcache_hits = 0;
+	r_lightcache_misses = 0;
 	r_outofsurfaces = 0;
 	r_outofedges = 0;
 
@@ -30,13 +30,29 @@ int		ramp1[8] = {0x6f, 0x6d, 0x6b, 0x69, 0x67, 0x65, 0x63, 0x61};
 int		ramp2[8] = {0x6f, 0x6e, 0x6d, 0x6c, 0x6b, 0x6a, 0x68, 0x66};
 int		ramp3[8] = {0x6d, 0x6b, 6, 5, 4, 3};
 
-particle_t	*active_particles, *free_particles;
+//
+// particles are kept structure-of-arrays and packed: the live ones are
+// always slots 0..r_activeparticles-1, new ones are appended, and dead
+// ones are squeezed out once per frame.  Each pass in R_DrawParticles
+// then streams through only the fields it needs.  Moving them is left to
+// an idle task, which gets slots 0..part_movecount-1 a step at a time.
+//
+float		*part_org[3], *part_vel[3];
+float		*part_ramp, *part_die;
+byte		*part_color, *part_type;
 
-particle_t	*particles;
 int			r_numparticles;
+int			r_activeparticles;
 
 vec3_t			r_pright, r_pup, r_ppn;
 
+#define PARTICLE_MOVE_STEP		128		// particles per idle task step
+
+static int		part_movenext, part_movecount;	// idle task progress
+static float	part_frametime;
+
+static int R_MoveParticlesIdle (void);
+
 
 /*
 ===============
@@ -60,15 +76,39 @@ void R_InitParticles (void)
 		r_numparticles = MAX_PARTICLES;
 	}
 
-	particles = (particle_t *)
-			Hunk_AllocName (r_numparticles * sizeof(particle_t), "particles");
+	part_org[0] = Hunk_AllocName (r_numparticles * 8 * sizeof(float), "particles");
+	part_org[1] = part_org[0] + r_numparticles;
+	part_org[2] = part_org[1] + r_numparticles;
+	part_vel[0] = part_org[2] + r_numparticles;
+	part_vel[1] = part_vel[0] + r_numparticles;
+	part_vel[2] = part_vel[1] + r_numparticles;
+	part_ramp = part_vel[2] + r_numparticles;
+	part_die = part_ramp + r_numparticles;
+	part_color = Hunk_AllocName (r_numparticles * 2, "particles");
+	part_type = part_color + r_numparticles;
+
+	Task_Register ("particles", R_MoveParticlesIdle, 200000);
+}
+
+/*
+===============
+R_NewParticle
+
+Returns the slot for a new particle, or -1 if they are all in use
+===============
+*/
+static inline int R_NewParticle (void)
+{
+	if (r_activeparticles == r_numparticles)
+		return -1;
+	return r_activeparticles++;
 }
 
 #ifdef QUAKE2
 void R_DarkFieldParticles (entity_t *ent)
 {
-	int			i, j, k;
-	particle_t	*p;
+	int			i, j, k, n;
+	int			p;
 	float		vel;
 	vec3_t		dir;
 	vec3_t		org;
@@ -80,28 +120,25 @@ void R_DarkFieldParticles (entity_t *ent)
 		for (j=-16 ; j<16 ; j+=8)
 			for (k=0 ; k<32 ; k+=8)
 			{
-				if (!free_particles)
+				if ((p = R_NewParticle ()) < 0)
 					return;
-				p = free_particles;
-				free_particles = p->next;
-				p->next = active_particles;
-				active_particles = p;
 		
-				p->die = cl.time + 0.2 + (rand()&7) * 0.02;
-				p->color = 150 + rand()%6;
-				p->type = pt_slowgrav;
+				part_die[p] = cl.time + 0.2 + (rand()&7) * 0.02;
+				part_color[p] = 150 + rand()%6;
+				part_type[p] = pt_slowgrav;
 				
 				dir[0] = j*8;
 				dir[1] = i*8;
 				dir[2] = k*8;
 	
-				p->org[0] = org[0] + i + (rand()&3);
-				p->org[1] = org[1] + j + (rand()&3);
-				p->org[2] = org[2] + k + (rand()&3);
+				part_org[0][p] = org[0] + i + (rand()&3);
+				part_org[1][p] = org[1] + j + (rand()&3);
+				part_org[2][p] = org[2] + k + (rand()&3);
 	
 				VectorNormalize (dir);						
 				vel = 50 + (rand()&63);
-				VectorScale (dir, vel, p->vel);
+				for (n=0 ; n<3 ; n++)
+					part_vel[n][p] = dir[n] * vel;
 			}
 }
 #endif
@@ -125,7 +162,7 @@ void R_EntityParticles (entity_t *ent)
 {
 	int			count;
 	int			i;
-	particle_t	*p;
+	int			p;
 	float		angle;
 	float		sr, sp, sy, cr, cp, cy;
 	vec3_t		forward;
@@ -157,20 +194,16 @@ avelocities[0][i] = (rand()&255) * 0.01;
 		forward[1] = cp*sy;
 		forward[2] = -sp;
 
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
-
-		p->die = cl.time + 0.01;
-		p->color = 0x6f;
-		p->type = pt_explode;
+
+		part_die[p] = cl.time + 0.01;
+		part_color[p] = 0x6f;
+		part_type[p] = pt_explode;
 		
-		p->org[0] = ent->origin[0] + r_avertexnormals[i][0]*dist + forward[0]*beamlength;			
-		p->org[1] = ent->origin[1] + r_avertexnormals[i][1]*dist + forward[1]*beamlength;			
-		p->org[2] = ent->origin[2] + r_avertexnormals[i][2]*dist + forward[2]*beamlength;			
+		part_org[0][p] = ent->origin[0] + r_avertexnormals[i][0]*dist + forward[0]*beamlength;			
+		part_org[1][p] = ent->origin[1] + r_avertexnormals[i][1]*dist + forward[1]*beamlength;			
+		part_org[2][p] = ent->origin[2] + r_avertexnormals[i][2]*dist + forward[2]*beamlength;			
 	}
 }
 
@@ -182,14 +215,8 @@ R_ClearParticles
 */
 void R_ClearParticles (void)
 {
-	int		i;
-	
-	free_particles = &particles[0];
-	active_particles = NULL;
-
-	for (i=0 ;i<r_numparticles ; i++)
-		particles[i].next = &particles[i+1];
-	particles[r_numparticles-1].next = NULL;
+	r_activeparticles = 0;
+	part_movenext = part_movecount = 0;
 }
 
 
@@ -198,8 +225,8 @@ void R_ReadPointFile_f (void)
 	FILE	*f;
 	vec3_t	org;
 	int		r;
-	int		c;
-	particle_t	*p;
+	int		c, n;
+	int			p;
 	char	name[MAX_OSPATH];
 	
 	sprintf (name,"maps/%s.pts", sv.name);
@@ -220,21 +247,18 @@ void R_ReadPointFile_f (void)
 			break;
 		c++;
 		
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 		{
 			Con_Printf ("Not enough free particles\n");
 			break;
 		}
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
 		
-		p->die = 99999;
-		p->color = (-c)&15;
-		p->type = pt_static;
-		VectorCopy (vec3_origin, p->vel);
-		VectorCopy (org, p->org);
+		part_die[p] = 99999;
+		part_color[p] = (-c)&15;
+		part_type[p] = pt_static;
+		part_vel[0][p] = part_vel[1][p] = part_vel[2][p] = 0;
+		for (n=0 ; n<3 ; n++)
+			part_org[n][p] = org[n];
 	}
 
 	fclose (f);
@@ -277,36 +301,32 @@ R_ParticleExplosion
 void R_ParticleExplosion (vec3_t org)
 {
 	int			i, j;
-	particle_t	*p;
+	int			p;
 	
 	for (i=0 ; i<1024 ; i++)
 	{
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
-
-		p->die = cl.time + 5;
-		p->color = ramp1[0];
-		p->ramp = rand()&3;
+
+		part_die[p] = cl.time + 5;
+		part_color[p] = ramp1[0];
+		part_ramp[p] = rand()&3;
 		if (i & 1)
 		{
-			p->type = pt_explode;
+			part_type[p] = pt_explode;
 			for (j=0 ; j<3 ; j++)
 			{
-				p->org[j] = org[j] + ((rand()%32)-16);
-				p->vel[j] = (rand()%512)-256;
+				part_org[j][p] = org[j] + ((rand()%32)-16);
+				part_vel[j][p] = (rand()%512)-256;
 			}
 		}
 		else
 		{
-			p->type = pt_explode2;
+			part_type[p] = pt_explode2;
 			for (j=0 ; j<3 ; j++)
 			{
-				p->org[j] = org[j] + ((rand()%32)-16);
-				p->vel[j] = (rand()%512)-256;
+				part_org[j][p] = org[j] + ((rand()%32)-16);
+				part_vel[j][p] = (rand()%512)-256;
 			}
 		}
 	}
@@ -321,27 +341,23 @@ R_ParticleExplosion2
 void R_ParticleExplosion2 (vec3_t org, int colorStart, int colorLength)
 {
 	int			i, j;
-	particle_t	*p;
+	int			p;
 	int			colorMod = 0;
 
 	for (i=0; i<512; i++)
 	{
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
 
-		p->die = cl.time + 0.3;
-		p->color = colorStart + (colorMod % colorLength);
+		part_die[p] = cl.time + 0.3;
+		part_color[p] = colorStart + (colorMod % colorLength);
 		colorMod++;
 
-		p->type = pt_blob;
+		part_type[p] = pt_blob;
 		for (j=0 ; j<3 ; j++)
 		{
-			p->org[j] = org[j] + ((rand()%32)-16);
-			p->vel[j] = (rand()%512)-256;
+			part_org[j][p] = org[j] + ((rand()%32)-16);
+			part_vel[j][p] = (rand()%512)-256;
 		}
 	}
 }
@@ -355,37 +371,33 @@ R_BlobExplosion
 void R_BlobExplosion (vec3_t org)
 {
 	int			i, j;
-	particle_t	*p;
+	int			p;
 	
 	for (i=0 ; i<1024 ; i++)
 	{
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
 
-		p->die = cl.time + 1 + (rand()&8)*0.05;
+		part_die[p] = cl.time + 1 + (rand()&8)*0.05;
 
 		if (i & 1)
 		{
-			p->type = pt_blob;
-			p->color = 66 + rand()%6;
+			part_type[p] = pt_blob;
+			part_color[p] = 66 + rand()%6;
 			for (j=0 ; j<3 ; j++)
 			{
-				p->org[j] = org[j] + ((rand()%32)-16);
-				p->vel[j] = (rand()%512)-256;
+				part_org[j][p] = org[j] + ((rand()%32)-16);
+				part_vel[j][p] = (rand()%512)-256;
 			}
 		}
 		else
 		{
-			p->type = pt_blob2;
-			p->color = 150 + rand()%6;
+			part_type[p] = pt_blob2;
+			part_color[p] = 150 + rand()%6;
 			for (j=0 ; j<3 ; j++)
 			{
-				p->org[j] = org[j] + ((rand()%32)-16);
-				p->vel[j] = (rand()%512)-256;
+				part_org[j][p] = org[j] + ((rand()%32)-16);
+				part_vel[j][p] = (rand()%512)-256;
 			}
 		}
 	}
@@ -400,50 +412,46 @@ R_RunParticleEffect
 void R_RunParticleEffect (vec3_t org, vec3_t dir, int color, int count)
 {
 	int			i, j;
-	particle_t	*p;
+	int			p;
 	
 	for (i=0 ; i<count ; i++)
 	{
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
 
 		if (count == 1024)
 		{	// rocket explosion
-			p->die = cl.time + 5;
-			p->color = ramp1[0];
-			p->ramp = rand()&3;
+			part_die[p] = cl.time + 5;
+			part_color[p] = ramp1[0];
+			part_ramp[p] = rand()&3;
 			if (i & 1)
 			{
-				p->type = pt_explode;
+				part_type[p] = pt_explode;
 				for (j=0 ; j<3 ; j++)
 				{
-					p->org[j] = org[j] + ((rand()%32)-16);
-					p->vel[j] = (rand()%512)-256;
+					part_org[j][p] = org[j] + ((rand()%32)-16);
+					part_vel[j][p] = (rand()%512)-256;
 				}
 			}
 			else
 			{
-				p->type = pt_explode2;
+				part_type[p] = pt_explode2;
 				for (j=0 ; j<3 ; j++)
 				{
-					p->org[j] = org[j] + ((rand()%32)-16);
-					p->vel[j] = (rand()%512)-256;
+					part_org[j][p] = org[j] + ((rand()%32)-16);
+					part_vel[j][p] = (rand()%512)-256;
 				}
 			}
 		}
 		else
 		{
-			p->die = cl.time + 0.1*(rand()%5);
-			p->color = (color&~7) + (rand()&7);
-			p->type = pt_slowgrav;
+			part_die[p] = cl.time + 0.1*(rand()%5);
+			part_color[p] = (color&~7) + (rand()&7);
+			part_type[p] = pt_slowgrav;
 			for (j=0 ; j<3 ; j++)
 			{
-				p->org[j] = org[j] + ((rand()&15)-8);
-				p->vel[j] = dir[j]*15;// + (rand()%300)-150;
+				part_org[j][p] = org[j] + ((rand()&15)-8);
+				part_vel[j][p] = dir[j]*15;// + (rand()%300)-150;
 			}
 		}
 	}
@@ -458,8 +466,8 @@ R_LavaSplash
 */
 void R_LavaSplash (vec3_t org)
 {
-	int			i, j, k;
-	particle_t	*p;
+	int			i, j, k, n;
+	int			p;
 	float		vel;
 	vec3_t		dir;
 
@@ -467,28 +475,25 @@ void R_LavaSplash (vec3_t org)
 		for (j=-16 ; j<16 ; j++)
 			for (k=0 ; k<1 ; k++)
 			{
-				if (!free_particles)
+				if ((p = R_NewParticle ()) < 0)
 					return;
-				p = free_particles;
-				free_particles = p->next;
-				p->next = active_particles;
-				active_particles = p;
 		
-				p->die = cl.time + 2 + (rand()&31) * 0.02;
-				p->color = 224 + (rand()&7);
-				p->type = pt_slowgrav;
+				part_die[p] = cl.time + 2 + (rand()&31) * 0.02;
+				part_color[p] = 224 + (rand()&7);
+				part_type[p] = pt_slowgrav;
 				
 				dir[0] = j*8 + (rand()&7);
 				dir[1] = i*8 + (rand()&7);
 				dir[2] = 256;
 	
-				p->org[0] = org[0] + dir[0];
-				p->org[1] = org[1] + dir[1];
-				p->org[2] = org[2] + (rand()&63);
+				part_org[0][p] = org[0] + dir[0];
+				part_org[1][p] = org[1] + dir[1];
+				part_org[2][p] = org[2] + (rand()&63);
 	
 				VectorNormalize (dir);						
 				vel = 50 + (rand()&63);
-				VectorScale (dir, vel, p->vel);
+				for (n=0 ; n<3 ; n++)
+					part_vel[n][p] = dir[n] * vel;
 			}
 }
 
@@ -500,8 +505,8 @@ R_TeleportSplash
 */
 void R_TeleportSplash (vec3_t org)
 {
-	int			i, j, k;
-	particle_t	*p;
+	int			i, j, k, n;
+	int			p;
 	float		vel;
 	vec3_t		dir;
 
@@ -509,28 +514,25 @@ void R_TeleportSplash (vec3_t org)
 		for (j=-16 ; j<16 ; j+=4)
 			for (k=-24 ; k<32 ; k+=4)
 			{
-				if (!free_particles)
+				if ((p = R_NewParticle ()) < 0)
 					return;
-				p = free_particles;
-				free_particles = p->next;
-				p->next = active_particles;
-				active_particles = p;
 		
-				p->die = cl.time + 0.2 + (rand()&7) * 0.02;
-				p->color = 7 + (rand()&7);
-				p->type = pt_slowgrav;
+				part_die[p] = cl.time + 0.2 + (rand()&7) * 0.02;
+				part_color[p] = 7 + (rand()&7);
+				part_type[p] = pt_slowgrav;
 				
 				dir[0] = j*8;
 				dir[1] = i*8;
 				dir[2] = k*8;
 	
-				p->org[0] = org[0] + i + (rand()&3);
-				p->org[1] = org[1] + j + (rand()&3);
-				p->org[2] = org[2] + k + (rand()&3);
+				part_org[0][p] = org[0] + i + (rand()&3);
+				part_org[1][p] = org[1] + j + (rand()&3);
+				part_org[2][p] = org[2] + k + (rand()&3);
 	
 				VectorNormalize (dir);						
 				vel = 50 + (rand()&63);
-				VectorScale (dir, vel, p->vel);
+				for (n=0 ; n<3 ; n++)
+					part_vel[n][p] = dir[n] * vel;
 			}
 }
 
@@ -539,7 +541,7 @@ void R_RocketTrail (vec3_t start, vec3_t end, int type)
 	vec3_t		vec;
 	float		len;
 	int			j;
-	particle_t	*p;
+	int			p;
 	int			dec;
 	static int	tracercount;
 
@@ -557,79 +559,76 @@ void R_RocketTrail (vec3_t start, vec3_t end, int type)
 	{
 		len -= dec;
 
-		if (!free_particles)
+		if ((p = R_NewParticle ()) < 0)
 			return;
-		p = free_particles;
-		free_particles = p->next;
-		p->next = active_particles;
-		active_particles = p;
 		
-		VectorCopy (vec3_origin, p->vel);
-		p->die = cl.time + 2;
+		part_vel[0][p] = part_vel[1][p] = part_vel[2][p] = 0;
+		part_die[p] = cl.time + 2;
 
 		switch (type)
 		{
 			case 0:	// rocket trail
-				p->ramp = (rand()&3);
-				p->color = ramp3[(int)p->ramp];
-				p->type = pt_fire;
+				part_ramp[p] = (rand()&3);
+				part_color[p] = ramp3[(int)part_ramp[p]];
+				part_type[p] = pt_fire;
 				for (j=0 ; j<3 ; j++)
-					p->org[j] = start[j] + ((rand()%6)-3);
+					part_org[j][p] = start[j] + ((rand()%6)-3);
 				break;
 
 			case 1:	// smoke smoke
-				p->ramp = (rand()&3) + 2;
-				p->color = ramp3[(int)p->ramp];
-				p->type = pt_fire;
+				part_ramp[p] = (rand()&3) + 2;
+				part_color[p] = ramp3[(int)part_ramp[p]];
+				part_type[p] = pt_fire;
 				for (j=0 ; j<3 ; j++)
-					p->org[j] = start[j] + ((rand()%6)-3);
+					part_org[j][p] = start[j] + ((rand()%6)-3);
 				break;
 
 			case 2:	// blood
-				p->type = pt_grav;
-				p->color = 67 + (rand()&3);
+				part_type[p] = pt_grav;
+				part_color[p] = 67 + (rand()&3);
 				for (j=0 ; j<3 ; j++)
-					p->org[j] = start[j] + ((rand()%6)-3);
+					part_org[j][p] = start[j] + ((rand()%6)-3);
 				break;
 
 			case 3:
 			case 5:	// tracer
-				p->die = cl.time + 0.5;
-				p->type = pt_static;
+				part_die[p] = cl.time + 0.5;
+				part_type[p] = pt_static;
 				if (type == 3)
-					p->color = 52 + ((tracercount&4)<<1);
+					part_color[p] = 52 + ((tracercount&4)<<1);
 				else
-					p->color = 230 + ((tracercount&4)<<1);
+					part_color[p] = 230 + ((tracercount&4)<<1);
 			
 				tracercount++;
 
-				VectorCopy (start, p->org);
+				for (j=0 ; j<3 ; j++)
+					part_org[j][p] = start[j];
 				if (tracercount & 1)
 				{
-					p->vel[0] = 30*vec[1];
-					p->vel[1] = 30*-vec[0];
+					part_vel[0][p] = 30*vec[1];
+					part_vel[1][p] = 30*-vec[0];
 				}
 				else
 				{
-					p->vel[0] = 30*-vec[1];
-					p->vel[1] = 30*vec[0];
+					part_vel[0][p] = 30*-vec[1];
+					part_vel[1][p] = 30*vec[0];
 				}
 				break;
 
 			case 4:	// slight blood
-				p->type = pt_grav;
-				p->color = 67 + (rand()&3);
+				part_type[p] = pt_grav;
+				part_color[p] = 67 + (rand()&3);
 				for (j=0 ; j<3 ; j++)
-					p->org[j] = start[j] + ((rand()%6)-3);
+					part_org[j][p] = start[j] + ((rand()%6)-3);
 				len -= 3;
 				break;
 
 			case 6:	// voor trail
-				p->color = 9*16 + 8 + (rand()&3);
-				p->type = pt_static;
-				p->die = cl.time + 0.3;
+				part_color[p] = 9*16 + 8 + (rand()&3);
+				part_type[p] = pt_static;
+				part_die[p] = cl.time + 0.3;
 				for (j=0 ; j<3 ; j++)
-					p->org[j] = start[j] + ((rand()&15)-8);
+					part_org[j][p] = start[j] + ((rand()&15)-8);
 				break;
 		}
 		
@@ -641,160 +640,185 @@ void R_RocketTrail (vec3_t start, vec3_t end, int type)
 
 /*
 ===============
-R_DrawParticles
+R_MoveParticles
+
+Integrates slots start..end-1 over the frame they were last drawn in
 ===============
 */
 extern	cvar_t	sv_gravity;
 
-void R_DrawParticles (void)
+static void R_MoveParticles (int start, int end)
 {
-	particle_t		*p, *kill;
-	float			grav;
 	int				i;
+	float			grav;
 	float			time2, time3;
 	float			time1;
 	float			dvel;
 	float			frametime;
-	
-#ifdef GLQUAKE
-	vec3_t			up, right;
-	float			scale;
-
-    GL_Bind(particletexture);
-	glEnable (GL_BLEND);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-	glBegin (GL_TRIANGLES);
-
-	VectorScale (vup, 1.5, up);
-	VectorScale (vright, 1.5, right);
-#else
-	D_StartParticles ();
+	float			*x, *y, *z, *vx, *vy, *vz;
 
-	VectorScale (vright, xscaleshrink, r_pright);
-	VectorScale (vup, yscaleshrink, r_pup);
-	VectorCopy (vpn, r_ppn);
-#endif
-	frametime = cl.time - cl.oldtime;
+	frametime = part_frametime;
 	time3 = frametime * 15;
 	time2 = frametime * 10; // 15;
 	time1 = frametime * 5;
 	grav = frametime * sv_gravity.value * 0.05;
 	dvel = 4*frametime;
-	
-	for ( ;; ) 
+
+// move
+	x = part_org[0];
+	y = part_org[1];
+	z = part_org[2];
+	vx = part_vel[0];
+	vy = part_vel[1];
+	vz = part_vel[2];
+	for (i=start ; i<end ; i++)
 	{
-		kill = active_particles;
-		if (kill && kill->die < cl.time)
-		{
-			active_particles = kill->next;
-			kill->next = free_particles;
-			free_particles = kill;
-			continue;
-		}
-		break;
+		x[i] += vx[i]*frametime;
+		y[i] += vy[i]*frametime;
+		z[i] += vz[i]*frametime;
 	}
 
-	for (p=active_particles ; p ; p=p->next)
+// per-type velocity and color ramps
+	for (i=start ; i<end ; i++)
 	{
-		for ( ;; )
-		{
-			kill = p->next;
-			if (kill && kill->die < cl.time)
-			{
-				p->next = kill->next;
-				kill->next = free_particles;
-				free_particles = kill;
-				continue;
-			}
-			break;
-		}
-
-#ifdef GLQUAKE
-		// hack a scale up to keep particles from disapearing
-		scale = (p->org[0] - r_origin[0])*vpn[0] + (p->org[1] - r_origin[1])*vpn[1]
-			+ (p->org[2] - r_origin[2])*vpn[2];
-		if (scale < 20)
-			scale = 1;
-		else
-			scale = 1 + scale * 0.004;
-		glColor3ubv ((byte *)&d_8to24table[(int)p->color]);
-		glTexCoord2f (0,0);
-		glVertex3fv (p->org);
-		glTexCoord2f (1,0);
-		glVertex3f (p->org[0] + up[0]*scale, p->org[1] + up[1]*scale, p->org[2] + up[2]*scale);
-		glTexCoord2f (0,1);
-		glVertex3f (p->org[0] + right[0]*scale, p->org[1] + right[1]*scale, p->org[2] + right[2]*scale);
-#else
-		D_DrawParticle (p);
-#endif
-		p->org[0] += p->vel[0]*frametime;
-		p->org[1] += p->vel[1]*frametime;
-		p->org[2] += p->vel[2]*frametime;
-		
-		switch (p->type)
+		switch (part_type[i])
 		{
 		case pt_static:
 			break;
 		case pt_fire:
-			p->ramp += time1;
-			if (p->ramp >= 6)
-				p->die = -1;
+			part_ramp[i] += time1;
+			if (part_ramp[i] >= 6)
+				part_die[i] = -1;
 			else
-				p->color = ramp3[(int)p->ramp];
-			p->vel[2] += grav;
+				part_color[i] = ramp3[(int)part_ramp[i]];
+			vz[i] += grav;
 			break;
 
 		case pt_explode:
-			p->ramp += time2;
-			if (p->ramp >=8)
-				p->die = -1;
+			part_ramp[i] += time2;
+			if (part_ramp[i] >=8)
+				part_die[i] = -1;
 			else
-				p->color = ramp1[(int)p->ramp];
-			for (i=0 ; i<3 ; i++)
-				p->vel[i] += p->vel[i]*dvel;
-			p->vel[2] -= grav;
+				part_color[i] = ramp1[(int)part_ramp[i]];
+			vx[i] += vx[i]*dvel;
+			vy[i] += vy[i]*dvel;
+			vz[i] += vz[i]*dvel;
+			vz[i] -= grav;
 			break;
 
 		case pt_explode2:
-			p->ramp += time3;
-			if (p->ramp >=8)
-				p->die = -1;
+			part_ramp[i] += time3;
+			if (part_ramp[i] >=8)
+				part_die[i] = -1;
 			else
-				p->color = ramp2[(int)p->ramp];
-			for (i=0 ; i<3 ; i++)
-				p->vel[i] -= p->vel[i]*frametime;
-			p->vel[2] -= grav;
+				part_color[i] = ramp2[(int)part_ramp[i]];
+			vx[i] -= vx[i]*frametime;
+			vy[i] -= vy[i]*frametime;
+			vz[i] -= vz[i]*frametime;
+			vz[i] -= grav;
 			break;
 
 		case pt_blob:
-			for (i=0 ; i<3 ; i++)
-				p->vel[i] += p->vel[i]*dvel;
-			p->vel[2] -= grav;
+			vx[i] += vx[i]*dvel;
+			vy[i] += vy[i]*dvel;
+			vz[i] += vz[i]*dvel;
+			vz[i] -= grav;
 			break;
 
 		case pt_blob2:
-			for (i=0 ; i<2 ; i++)
-				p->vel[i] -= p->vel[i]*dvel;
-			p->vel[2] -= grav;
+			vx[i] -= vx[i]*dvel;
+			vy[i] -= vy[i]*dvel;
+			vz[i] -= grav;
 			break;
 
 		case pt_grav:
 #ifdef QUAKE2
-			p->vel[2] -= grav * 20;
+			vz[i] -= grav * 20;
 			break;
 #endif
 		case pt_slowgrav:
-			p->vel[2] -= grav;
+			vz[i] -= grav;
 			break;
 		}
 	}
+}
 
-#ifdef GLQUAKE
-	glEnd ();
-	glDisable (GL_BLEND);
-	glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_REPLACE);
-#else
-	D_EndParticles ();
-#endif
+/*
+===============
+R_MoveParticlesIdle
+
+Idle task: moves the particles drawn last frame a step at a time from
+accelerator waits.  Only slots that were live at draw time are touched;
+new ones are appended past them and dead ones stay put until the next
+R_DrawParticles squeezes them out.
+===============
+*/
+static int R_MoveParticlesIdle (void)
+{
+	int		end;
+
+	if (part_movenext >= part_movecount)
+		return 0;		// done for this frame
+
+	end = part_movenext + PARTICLE_MOVE_STEP;
+	if (end > part_movecount)
+		end = part_movecount;
+	R_MoveParticles (part_movenext, end);
+	part_movenext = end;
+
+	return part_movenext < part_movecount;
 }
 
+/*
+===============
+R_DrawParticles
+
+Finishes last frame's moves, packs out the dead, draws the rest in one
+batch, then leaves them to be moved by the idle task.
+===============
+*/
+void R_DrawParticles (void)
+{
+	int				i, n, count;
+
+// whatever the idle task did not get to
+	R_MoveParticles (part_movenext, part_movecount);
+	part_movenext = part_movecount = 0;
+
+	D_StartParticles ();
+
+	VectorScale (vright, xscaleshrink, r_pright);
+	VectorScale (vup, yscaleshrink, r_pup);
+	VectorCopy (vpn, r_ppn);
+
+// squeeze out the dead
+	count = r_activeparticles;
+	for (i=0, n=0 ; i<count ; i++)
+	{
+		if (part_die[i] < cl.time)
+			continue;
+		if (i != n)
+		{
+			part_org[0][n] = part_org[0][i];
+			part_org[1][n] = part_org[1][i];
+			part_org[2][n] = part_org[2][i];
+			part_vel[0][n] = part_vel[0][i];
+			part_vel[1][n] = part_vel[1][i];
+			part_vel[2][n] = part_vel[2][i];
+			part_ramp[n] = part_ramp[i];
+			part_die[n] = part_die[i];
+			part_color[n] = part_color[i];
+			part_type[n] = part_type[i];
+		}
+		n++;
+	}
+	r_activeparticles = count = n;
+
+	D_DrawParticles (count, part_org, part_color);
+
+// move
+	part_frametime = cl.time - cl.oldtime;
+	part_movecount = count;
+
+	D_EndParticles ();
+}
@@ -44,6 +44,12 @@ unsigned char	*r_source, *r_sourcemax;
 #if HW_SURFBLOCK_ACCEL
 static void R_DrawSurfaceBlock8_unified (void);
 
+// block descriptor list walked by the rasterizer, one 4-word entry per
+// block; a surface has at most 17x17 blocks (see blocklights)
+#define SURF_DMA_MAX_BLOCKS	(17*17)
+static unsigned int surf_dma_buf[SURF_DMA_MAX_BLOCKS * 4] __attribute__((aligned(16)));
+static int surf_dma_count;
+
 static void	(*surfmiptable[4])(void) = {
 	R_DrawSurfaceBlock8_unified,
 	R_DrawSurfaceBlock8_unified,
@@ -327,6 +333,13 @@ void R_DrawSurface (void)
 
 	pcolumndest = r_drawsurf.surfdat;
 
+#if HW_SURFBLOCK_ACCEL
+	span_set_surface_steps ((unsigned int)sourcetstep, (unsigned int)surfrowbytes);
+	SURF_DMA_CTRL = (unsigned int)blockdivshift;
+	SURF_DMA_BASE = (unsigned int)surf_dma_buf;
+	surf_dma_count = 0;
+#endif
+
 	for (u=0 ; u<r_numhblocks; u++)
 	{
 		r_lightptr = blocklights + u;
@@ -343,6 +356,12 @@ void R_DrawSurface (void)
 
 		pcolumndest += horzblockstep;
 	}
+
+#if HW_SURFBLOCK_ACCEL
+// columns stream back to back through the block queue; the surface is
+// only complete once the last one drains
+	span_wait ();
+#endif
 }
 
 
@@ -356,23 +375,29 @@ void R_DrawSurface (void)
 R_DrawSurfaceBlock8_unified
 
 Unified surface block function for all mip levels.
-Hardware handles all rows autonomously with bilinear light interpolation.
+Writes one descriptor per block of the column and kicks the column; the
+rasterizer walks them from SDRAM with bilinear light interpolation while
+the CPU builds the next column.  Row strides, blockdivshift and the list
+base are set once per surface in R_DrawSurface.
 ================
 */
 static void R_DrawSurfaceBlock8_unified (void)
 {
 	unsigned char	*psource = pbasesource;
 	unsigned char	*prowdest = prowdestbase;
+	volatile unsigned int	*desc;
+
+	desc = (volatile unsigned int *)
+		((unsigned int)&surf_dma_buf[surf_dma_count * 4] + 0x40000000);
 
 	for (int v = 0; v < r_numvblocks; v++)
 	{
-		while (!span_can_accept()) span_pump_audio();
-		span_draw_surface_block(
-			(unsigned int)prowdest, (unsigned int)psource,
-			r_lightptr[0], r_lightptr[1],
-			r_lightptr[r_lightwidth], r_lightptr[r_lightwidth + 1],
-			(unsigned int)sourcetstep, (unsigned int)surfrowbytes,
-			blockdivshift);
+		desc[0] = (unsigned int)prowdest;
+		desc[1] = (unsigned int)psource;
+		desc[2] = SURF_DESC_LIGHT(r_lightptr[0], r_lightptr[1]);
+		desc[3] = SURF_DESC_LIGHT(r_lightptr[r_lightwidth],
+		                          r_lightptr[r_lightwidth + 1]);
+		desc += 4;
 
 		r_lightptr += r_lightwidth;
 		prowdest += blocksize * surfrowbytes;
@@ -380,7 +405,9 @@ static void R_DrawSurfaceBlock8_unified (void)
 		if (psource >= r_sourcemax)
 			psource -= r_stepback;
 	}
-	span_wait();
+
+	surf_dma_count += r_numvblocks;
+	SURF_DMA_KICK = (unsigned int)r_numvblocks;
 }
 #endif /* HW_SURFBLOCK_ACCEL */
 
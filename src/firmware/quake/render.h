@@ -36,6 +36,15 @@ typedef struct efrag_s
 } efrag_t;
 
 
+// R_LightPointCached: where the last light trace for an entity landed
+typedef struct
+{
+	int						key[3];		// origin rounded down when traced
+	int						gen;		// r_lightgen when traced, 0 = empty
+	struct msurface_s		*surf;		// surface hit, NULL if none
+	byte					*sample;	// style 0 lightmap texel, NULL if unlit
+} entlight_t;
+
 typedef struct entity_s
 {
 	qboolean				forcelink;		// model changed
@@ -67,6 +76,7 @@ typedef struct entity_s
 	struct mnode_s			*topnode;		// for bmodels, first world node
 											//  that splits bmodel, or NULL if
 											//  not split
+	entlight_t				light;			// cached R_LightPoint trace
 } entity_t;
 
 // !!! if this is changed, it must be changed in asm_draw.h too !!!
@@ -117,6 +127,7 @@ void R_Init (void);
 void R_InitTextures (void);
 void R_InitEfrags (void);
 void R_RenderView (void);		// must set r_refdef first
+void R_DrawGovernor (void);		// frame-time governor overlay
 void R_ViewChanged (vrect_t *pvrect, int lineadj, float aspect);
 								// called whenever r_refdef or vid change
 void R_InitSky (struct texture_s *mt);	// called at level load
@@ -75,6 +75,10 @@ CENTER PRINTING
 char		scr_centerstring[1024];
 float		scr_centertime_start;	// for slow victory printing
 float		scr_centertime_off;
+
+qboolean	scr_viewoverlay;
+extern cvar_t	crosshair;
+extern cvar_t	r_govern_show;
 int			scr_center_lines;
 int			scr_erase_lines;
 int			scr_erase_center;
@@ -902,6 +906,13 @@ void SCR_UpdateScreen (void)
 	VID_LockBuffer ();
 	pq_dbg_stage = 0x3001;
 
+// the dynamic resolution scaler stretches the whole view rect at scanout,
+// so anything drawn over the view must keep it at native size
+	scr_viewoverlay = scr_drawdialog || scr_drawloading || cl.intermission
+		|| key_dest != key_game || scr_con_current || crosshair.value
+		|| (cl.paused && scr_showpause.value) || scr_centertime_off > 0
+		|| r_govern_show.value || Con_NotifyVisible ();
+
 	V_RenderView ();
 	pq_dbg_stage = 0x3002;
 
@@ -940,6 +951,7 @@ void SCR_UpdateScreen (void)
 		SCR_DrawNet ();
 		SCR_DrawTurtle ();
 		SCR_DrawPause ();
+		R_DrawGovernor ();
 		SCR_CheckDrawCenterString ();
 		Sbar_Draw ();
 		SCR_DrawConsole ();
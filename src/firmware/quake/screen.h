@@ -39,6 +39,7 @@ extern	float		scr_conlines;		// lines of console to display
 
 extern	int			scr_fullupdate;	// set to 0 to force full redraw
 extern	int			sb_lines;
+extern	qboolean	scr_viewoverlay;	// 2D will be drawn over the 3D view this frame
 
 extern	int			clearnotify;	// set to 0 whenever notify text is drawn
 extern	qboolean	scr_disabled_for_loading;
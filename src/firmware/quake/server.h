@@ -59,6 +59,7 @@ typedef struct
 	edict_t		*edicts;			// can NOT be array indexed, because
 									// edict_t is variable sized, but can
 									// be used to reference the world ent
+	struct areaproxy_s	*areaproxies;	// [max_edicts], see world.h
 	server_state_t	state;			// some actions are only valid during load
 
 	sizebuf_t	datagram;
@@ -211,6 +212,9 @@ extern	jmp_buf 	host_abortserver;
 
 extern	float		host_time;
 
+extern	cvar_t		sv_tickrate;
+extern	float		host_tickfrac;		// 0..1 position between fixed server ticks
+
 extern	edict_t		*sv_player;
 
 //===========================================================
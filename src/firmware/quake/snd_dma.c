@@ -21,7 +21,7 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 #include "quakedef.h"
 
-void S_PaintChannels(int endtime);
+void S_PaintChannels(int endtime, qboolean noload);
 void SND_InitScaletable(void);
 void SNDDMA_Submit(void);
 void SNDDMA_FillRing(void);
@@ -208,6 +208,7 @@ void S_Init(void)
     Cvar_RegisterVariable(&_snd_mixahead);
 
     snd_initialized = true;
+    Task_Register("sndpaint", S_IdlePaint, 300000);
 
     S_Startup();
 
@@ -572,7 +573,7 @@ void S_Update(vec3_t origin, vec3_t forward, vec3_t right, vec3_t up)
     if (endtime - soundtime > samps)
         endtime = soundtime + samps;
 
-    S_PaintChannels(endtime);
+    S_PaintChannels(endtime, false);
 
     if (audio_timer_active)
         SNDDMA_FillRing();
@@ -580,6 +581,43 @@ void S_Update(vec3_t origin, vec3_t forward, vec3_t right, vec3_t up)
         SNDDMA_Submit();
 }
 
+// ====================================================================
+// S_IdlePaint - idle task: mix a little further ahead from an
+// accelerator wait, so less is left for S_Update at frame end.
+// Only sounds already in the cache are mixed; loading one goes through
+// the dataslot bridge and may evict model data mid-frame, so that is
+// left to S_Update.
+// ====================================================================
+
+#define IDLE_PAINT_SAMPLES  128
+
+int S_IdlePaint(void)
+{
+    int endtime;
+    int samps;
+
+    if (!sound_started || (snd_blocked > 0))
+        return 0;
+
+    GetSoundtime();
+
+    if (paintedtime < soundtime)
+        paintedtime = soundtime;
+
+    samps = shm->samples / shm->channels;
+    endtime = soundtime + (int)(_snd_mixahead.value * shm->speed);
+    if (endtime - soundtime > samps)
+        endtime = soundtime + samps;
+
+    if (paintedtime >= endtime)
+        return 0;
+    if (endtime - paintedtime > IDLE_PAINT_SAMPLES)
+        endtime = paintedtime + IDLE_PAINT_SAMPLES;
+
+    S_PaintChannels(endtime, true);
+    return 1;
+}
+
 void S_ExtraUpdate(void)
 {
     if (!sound_started)
@@ -149,25 +149,36 @@ static void ResampleSfx(sfx_t *sfx, int inrate, int inwidth, byte *data, int ins
     if (!sc)
         return;
 
-    short *out = (short *)sc->data;
     outcount = sc->length;
     fracstep = ((long long)inrate << 8) / shm->speed;
     samplefrac = 0;
 
+    // 8-bit sources stay 8-bit (signed) so the cache costs a byte a sample
+    if (sc->width == 1) {
+        signed char *out8 = (signed char *)sc->data;
+
+        for (i = 0; i < outcount; i++) {
+            int srcsample = samplefrac >> 8;
+            int frac = samplefrac & 0xFF;
+            samplefrac += fracstep;
+
+            int s0 = (int)data[srcsample] - 128;
+            int s1 = (srcsample + 1 < insamps) ? (int)data[srcsample + 1] - 128 : s0;
+
+            out8[i] = (signed char)(s0 + (((s1 - s0) * frac) >> 8));
+        }
+        return;
+    }
+
+    short *out = (short *)sc->data;
+
     for (i = 0; i < outcount; i++) {
         int srcsample = samplefrac >> 8;
         int frac = samplefrac & 0xFF;
         samplefrac += fracstep;
 
-        int s0, s1;
-        if (inwidth == 2) {
-            s0 = ((short *)data)[srcsample];
-            s1 = (srcsample + 1 < insamps) ? ((short *)data)[srcsample + 1] : s0;
-        } else {
-            s0 = ((int)((unsigned char)data[srcsample]) - 128) << 8;
-            s1 = (srcsample + 1 < insamps)
-                ? ((int)((unsigned char)data[srcsample + 1]) - 128) << 8 : s0;
-        }
+        int s0 = ((short *)data)[srcsample];
+        int s1 = (srcsample + 1 < insamps) ? ((short *)data)[srcsample + 1] : s0;
 
         // Linear interpolation, store as 16-bit signed
         out[i] = (short)(s0 + (((s1 - s0) * frac) >> 8));
@@ -214,8 +225,8 @@ sfxcache_t *S_LoadSound(sfx_t *s)
         return NULL;
     }
 
-    // Allocate cache entry: header + 16-bit mono samples
-    sc = Cache_Alloc(&s->cache, sizeof(sfxcache_t) + len * 2, s->name);
+    // Allocate cache entry: header + mono samples at the source width
+    sc = Cache_Alloc(&s->cache, sizeof(sfxcache_t) + len * info.width, s->name);
     if (!sc)
         return NULL;
 
@@ -224,7 +235,7 @@ sfxcache_t *S_LoadSound(sfx_t *s)
     if (sc->loopstart >= 0)
         sc->loopstart = (int)((long long)sc->loopstart * shm->speed / info.rate);
     sc->speed = shm->speed;
-    sc->width = 2;
+    sc->width = info.width;
     sc->stereo = 0;
 
     ResampleSfx(s, info.rate, info.width, data + info.dataofs, info.samples);
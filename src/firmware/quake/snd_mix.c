@@ -25,10 +25,26 @@ Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
 
 portable_samplepair_t paintbuffer[PAINTBUFFER_SIZE];
 
+int snd_scaletable[32][256];
+
+void SND_PaintChannelFrom8(channel_t *ch, sfxcache_t *sc, int count);
 void SND_PaintChannelFrom16(channel_t *ch, sfxcache_t *sc, int count);
 
+/*
+================
+SND_InitScaletable
+
+Signed 8-bit sample times volume, in the same units the 16-bit painter
+accumulates (sample << 8 times volume), so both paths share the paintbuffer.
+================
+*/
 void SND_InitScaletable(void)
 {
+    int i, j;
+
+    for (i = 0; i < 32; i++)
+        for (j = 0; j < 256; j++)
+            snd_scaletable[i][j] = ((signed char)j) * i * 8 * 256;
 }
 
 static void S_TransferPaintBuffer(int count)
@@ -60,7 +76,8 @@ static void S_TransferPaintBuffer(int count)
     }
 }
 
-void S_PaintChannels(int endtime)
+// noload: mix only sounds already resident (Cache_Check), never load one
+void S_PaintChannels(int endtime, qboolean noload)
 {
     int i;
     int end;
@@ -85,7 +102,10 @@ void S_PaintChannels(int endtime)
             if (!ch->leftvol && !ch->rightvol)
                 continue;
 
-            sc = S_LoadSound(ch->sfx);
+            if (noload)
+                sc = (sfxcache_t *)Cache_Check(&ch->sfx->cache);
+            else
+                sc = S_LoadSound(ch->sfx);
             if (!sc)
                 continue;
 
@@ -99,7 +119,10 @@ void S_PaintChannels(int endtime)
                     count = end - ltime;
 
                 if (count > 0) {
-                    SND_PaintChannelFrom16(ch, sc, count);
+                    if (sc->width == 1)
+                        SND_PaintChannelFrom8(ch, sc, count);
+                    else
+                        SND_PaintChannelFrom16(ch, sc, count);
                     ltime += count;
                 }
 
@@ -124,6 +147,30 @@ void S_PaintChannels(int endtime)
     }
 }
 
+void SND_PaintChannelFrom8(channel_t *ch, sfxcache_t *sc, int count)
+{
+    unsigned char *sfx;
+    int *lscale, *rscale;
+    int i;
+    int leftvol = ch->leftvol;
+    int rightvol = ch->rightvol;
+
+    if (leftvol > 255) leftvol = 255;
+    if (rightvol > 255) rightvol = 255;
+
+    lscale = snd_scaletable[leftvol >> 3];
+    rscale = snd_scaletable[rightvol >> 3];
+    sfx = (unsigned char *)sc->data + ch->pos;
+
+    for (i = 0; i < count; i++) {
+        int data = sfx[i];
+        paintbuffer[i].left += lscale[data];
+        paintbuffer[i].right += rscale[data];
+    }
+
+    ch->pos += count;
+}
+
 void SND_PaintChannelFrom16(channel_t *ch, sfxcache_t *sc, int count)
 {
     short *sfx;
@@ -18,9 +18,8 @@
 
 #include "quakedef.h"
 
-// CD music: CPU feeds raw 44100Hz samples to HW resampler FIFO via MMIO.
-// HW handles resampling to 48kHz, volume, and mixing with SFX.
-extern void CDAudio_CopyToHW(void);
+// CD music: the HW resampler fetches raw 44100Hz samples from the SDRAM
+// ring itself, and handles resampling to 48kHz, volume, and mixing with SFX.
 
 // ============================================
 // Audio MMIO registers (FPGA audio_output module)
@@ -104,14 +103,10 @@ int SNDDMA_GetDMAPos(void)
 // SNDDMA_FillRing - upsample/mix into BRAM ring (main loop)
 //
 // Called from S_Update, S_ExtraUpdate, and span_pump_audio.
-// Reads from uncached SDRAM mix buffer + CD music, writes to BRAM ring.
+// Reads from uncached SDRAM mix buffer, writes to BRAM ring.
 // ============================================
 PQ_FASTTEXT void SNDDMA_FillRing(void)
 {
-    // Keep the HW resampler's CD audio FIFO fed (runs at 44100 Hz).
-    // Must be called frequently to avoid underrun at low framerates.
-    CDAudio_CopyToHW();
-
     short *buf = snd_buffer;
     int fmask = (SND_BUFFER_SIZE / 2) - 1;
 
@@ -99,13 +99,14 @@ void S_StopAllSounds(qboolean clear);
 void S_ClearBuffer (void);
 void S_Update (vec3_t origin, vec3_t v_forward, vec3_t v_right, vec3_t v_up);
 void S_ExtraUpdate (void);
+int S_IdlePaint (void);		// idle task, see task.h
 
 sfx_t *S_PrecacheSound (char *sample);
 void S_TouchSound (char *sample);
 void S_ClearPrecache (void);
 void S_BeginPrecaching (void);
 void S_EndPrecaching (void);
-void S_PaintChannels(int endtime);
+void S_PaintChannels(int endtime, qboolean noload);
 void S_InitPaintChannels (void);
 
 // picks a channel based on priorities, empty slots, number of channels
@@ -1,6 +1,8 @@
 #ifndef SPAN_ACCEL_H
 #define SPAN_ACCEL_H
 
+#include "task.h"
+
 /*
  * Hardware Span Rasterizer
  * - Textured span mode: offloads D_DrawSpans8 inner pixel loop.
@@ -77,6 +79,20 @@
 #define SPAN_DMA_STATUS          (*(volatile unsigned int *)(SPAN_BASE + 0xDC))
 #define SPAN_DMA_CTRL            (*(volatile unsigned int *)(SPAN_BASE + 0xE0))
 
+/* Surface block descriptor list registers (slots 57-59).
+ * Each descriptor is 4 words, 16-byte aligned: dest, src,
+ * SURF_DESC_LIGHT(tl, tr), SURF_DESC_LIGHT(bl, br).  KICK appends to the
+ * walk, so a surface can be queued a column at a time while it draws. */
+#define SURF_DMA_BASE            (*(volatile unsigned int *)(SPAN_BASE + 0xE4))
+#define SURF_DMA_KICK            (*(volatile unsigned int *)(SPAN_BASE + 0xE8))
+#define SURF_DMA_STATUS          (*(volatile unsigned int *)(SPAN_BASE + 0xE8))
+#define SURF_DMA_CTRL            (*(volatile unsigned int *)(SPAN_BASE + 0xEC))
+
+/* Pack two 8.8 light corners of a block row: {right[31:16], left[15:0]} */
+#define SURF_DESC_LIGHT(left, right) \
+    (((unsigned int)((right) & 0xFFFF) << 16) | \
+     ((unsigned int)((left) & 0xFFFF)))
+
 /* Pack a span descriptor: {count[29:20], v[19:10], u[9:0]} */
 #define SPAN_DESC_PACK(u, v, count) \
     (((unsigned int)((count) & 0x3FF) << 20) | \
@@ -108,7 +124,8 @@
 
 /* Service audio during hardware wait loops.
  * Fill the BRAM ring buffer so the timer ISR can drain it to the FIFO.
- * When timer ISR is inactive, also drain directly to the FIFO. */
+ * When timer ISR is inactive, also drain directly to the FIFO.
+ * Whatever wait is left goes to the idle task queue. */
 extern void SNDDMA_FillRing(void);
 extern void SNDDMA_Submit(void);
 extern int audio_timer_active;
@@ -118,6 +135,7 @@ static inline void span_pump_audio(void)
         SNDDMA_FillRing();
     else
         SNDDMA_Submit();
+    Task_Idle();
 }
 
 /* Block until span completes, servicing audio in the meantime */
@@ -285,26 +303,32 @@ static inline void span_z_draw(unsigned int z_addr, int izi, int izistep, int co
     SPAN_ZCONTROL  = (unsigned int)count;  /* triggers start */
 }
 
-/* Start a surface block draw (non-blocking).
+/* Set the sticky surface block row strides in bytes (call once per surface).
+ * Every block register is latched when a block is queued, so this is safe
+ * while blocks of the previous surface are still in flight. */
+static inline void span_set_surface_steps(unsigned int tex_step, unsigned int dest_step)
+{
+    SURF_TEX_STEP   = tex_step;
+    SURF_DEST_STEP  = dest_step;
+}
+
+/* Queue a surface block draw (non-blocking; check span_can_accept first).
  * Hardware autonomously iterates all rows, interpolating light bilinearly.
  * dest/src are CPU byte addresses. Light corners are 8.8 fixed-point values.
- * tex_step/dest_step are row strides in bytes. blockdivshift is log2(blocksize). */
+ * blockdivshift is log2(blocksize).  Up to two blocks queue behind the one
+ * running, so the CPU can set up the rest of the surface meanwhile. */
 static inline void span_draw_surface_block(
     unsigned int dest, unsigned int src,
     unsigned int light_tl, unsigned int light_tr,
     unsigned int light_bl, unsigned int light_br,
-    unsigned int tex_step, unsigned int dest_step,
     int blockdivshift)
 {
-    span_wait();
     SPAN_FB_ADDR    = dest;
     SPAN_TEX_ADDR   = src;
     SURF_LIGHT_TL   = light_tl;
     SURF_LIGHT_TR   = light_tr;
     SURF_LIGHT_BL   = light_bl;
     SURF_LIGHT_BR   = light_br;
-    SURF_TEX_STEP   = tex_step;
-    SURF_DEST_STEP  = dest_step;
     SURF_CONTROL    = (unsigned int)blockdivshift;  /* triggers start */
 }
 
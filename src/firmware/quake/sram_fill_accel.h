@@ -7,6 +7,8 @@
 #ifndef SRAM_FILL_ACCEL_H
 #define SRAM_FILL_ACCEL_H
 
+#include "task.h"
+
 #define SRAM_FILL_BASE     0x5C000000u
 
 #define SRAM_FILL_DST      (*(volatile unsigned int *)(SRAM_FILL_BASE + 0x00))
@@ -26,7 +28,7 @@ static inline void sram_fill_start(unsigned int dst_addr, unsigned int length, u
 static inline void sram_fill_wait(void)
 {
     while (SRAM_FILL_STATUS & 1)
-        ;
+        Task_Idle();
 }
 
 #endif /* SRAM_FILL_ACCEL_H */
@@ -46,6 +46,8 @@ void SV_Init (void)
 	extern	cvar_t	sv_accelerate;
 	extern	cvar_t	sv_idealpitchscale;
 	extern	cvar_t	sv_aim;
+	extern	cvar_t	sv_hullcheck;
+	extern	cvar_t	sv_tracecache;
 
 	Cvar_RegisterVariable (&sv_maxvelocity);
 	Cvar_RegisterVariable (&sv_gravity);
@@ -57,6 +59,9 @@ void SV_Init (void)
 	Cvar_RegisterVariable (&sv_idealpitchscale);
 	Cvar_RegisterVariable (&sv_aim);
 	Cvar_RegisterVariable (&sv_nostep);
+	Cvar_RegisterVariable (&sv_hullcheck);
+	Cvar_RegisterVariable (&sv_tracecache);
+	Cmd_AddCommand ("tracestats", SV_TraceStats_f);
 
 	for (i=0 ; i<MAX_MODELS ; i++)
 		sprintf (localmodels[i], "*%i", i);
@@ -1215,6 +1220,7 @@ void SV_SpawnServer (char *server)
 	sv.max_edicts = MAX_EDICTS;
 
 	sv.edicts = Hunk_AllocName (sv.max_edicts*pr_edict_size, "edicts");
+	sv.areaproxies = Hunk_AllocName (sv.max_edicts*sizeof(areaproxy_t), "areaproxies");
 
 	sv.datagram.maxsize = sizeof(sv.datagram_buf);
 	sv.datagram.cursize = 0;
@@ -1509,6 +1509,8 @@ void SV_Physics (void)
 	int		i;
 	edict_t	*ent;
 
+	SV_InvalidateTraceCache ();
+
 // let the progs know that a new frame has started
 	pr_global_struct->self = EDICT_TO_PROG(sv.edicts);
 	pr_global_struct->other = EDICT_TO_PROG(sv.edicts);
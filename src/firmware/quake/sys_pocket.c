@@ -57,13 +57,12 @@ static int pak_numfiles;
 static int pak_total_size;  /* dirofs + dirlen, returned by Sys_FileOpenRead */
 static int pak_initialized = 0;
 
-/* (DMA buffer at fixed SDRAM address DMA_BUFFER, read via SDRAM_UNCACHED) */
+/* (DMA buffer at fixed SDRAM address DMA_BUFFER, read via dma_read_view) */
 
 /* Terminal printf for error reporting */
 extern void term_printf(const char *fmt, ...);
 
-/* Volatile-safe copy from uncached SDRAM DMA buffer to dest.
- * Ensures each word is actually read from hardware (not optimized by LTO). */
+/* Copy freshly DMA'd data from the SDRAM DMA buffer to dest. */
 static void dma_copy(void *dest, int count);
 
 static void Pak_Init(void)
@@ -110,7 +109,7 @@ static void Pak_Init(void)
     if (pak_numfiles > MAX_PAK_FILES)
         pak_numfiles = MAX_PAK_FILES;
 
-    /* Read PAK directory: DMA to SDRAM, volatile copy from uncacheable alias to BSS. */
+    /* Read PAK directory: DMA to SDRAM, then copy to BSS. */
     {
         int dir_bytes = pak_numfiles * sizeof(pakfile_t);
         int done = 0;
@@ -304,28 +303,13 @@ static int dma_total_calls = 0;
 static int dma_total_errors = 0;
 static int dma_stale_hits = 0;
 
-/* Volatile-safe copy from uncached SDRAM alias.
- * Q_memcpy's src parameter is void* (non-volatile), so LTO can optimize
- * reads from the uncached alias into cached/reordered reads. This function
- * ensures each word is actually read from hardware via volatile. */
+/* Copy from the DMA buffer through dma_read_view: whole chunks come in
+ * as cached line refills once the stale lines are dropped, smaller ones
+ * through the uncached alias.  The view also fences the loads after the
+ * DMA completion, so LTO cannot hoist them above dataslot_read. */
 static void dma_copy(void *dest, int count)
 {
-    volatile unsigned int *src =
-        (volatile unsigned int *)SDRAM_UNCACHED(DMA_BUFFER);
-    unsigned int *dst = (unsigned int *)dest;
-    int words = count >> 2;
-    int i;
-    for (i = 0; i < words; i++)
-        dst[i] = src[i];
-    /* Handle trailing bytes */
-    int tail = count & 3;
-    if (tail) {
-        volatile unsigned char *sb =
-            (volatile unsigned char *)SDRAM_UNCACHED(DMA_BUFFER);
-        unsigned char *db = (unsigned char *)dest;
-        for (i = words * 4; i < count; i++)
-            db[i] = sb[i];
-    }
+    Q_memcpy(dest, (void *)dma_read_view(DMA_BUFFER, count), count);
 }
 
 #define DMA_SENTINEL  0xBAADF00D
@@ -387,8 +371,6 @@ int Sys_FileRead(int handle, void *dest, int count)
                         return done;
                 }
 
-                /* Volatile copy: ensures each word is actually read from
-                 * uncached SDRAM, preventing LTO from caching/reordering. */
                 dma_copy((byte *)dest + done, chunk);
                 done += chunk;
             }
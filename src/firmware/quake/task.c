@@ -0,0 +1,183 @@
+/*
+Copyright (C) 1996-1997 Id Software, Inc.
+
+This program is free software; you can redistribute it and/or
+modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation; either version 2
+of the License, or (at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+
+See the GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+
+*/
+// task.c -- work run from accelerator wait loops
+
+#include "quakedef.h"
+
+typedef struct
+{
+	char		*name;
+	taskfunc_t	func;
+	unsigned int	budget;			// cycles per frame
+
+	unsigned int	frame_cycles;
+	unsigned int	frame_runs;
+
+	// totals since the last "tasks" report
+	unsigned int	total_cycles;
+	unsigned int	total_runs;
+	unsigned int	max_cycles;		// longest single step
+	unsigned int	exhausted;		// frames that ran out of budget
+} task_t;
+
+cvar_t	task_idle = {"task_idle", "1"};
+
+unsigned int	task_pending;
+
+static task_t	tasks[MAX_TASKS];
+static int		task_count;
+static int		task_next;
+static int		task_busy;
+static unsigned int	task_frames;
+
+/*
+================
+Task_RunIdle
+
+Runs one step of the next pending task, round robin.  Called from wait
+loops, so a step that starts work of its own would nest and is refused.
+================
+*/
+void Task_RunIdle (void)
+{
+	int				i, n, more;
+	unsigned int	start, cycles;
+	task_t			*t;
+
+	if (task_busy)
+		return;
+	task_busy = 1;
+
+	for (n=0 ; n<task_count ; n++)
+	{
+		i = task_next;
+		if (++task_next == task_count)
+			task_next = 0;
+		if (!(task_pending & (1<<i)))
+			continue;
+
+		t = &tasks[i];
+		start = SYS_CYCLE_LO;
+		more = t->func ();
+		cycles = SYS_CYCLE_LO - start;
+
+		t->frame_cycles += cycles;
+		t->frame_runs++;
+		if (cycles > t->max_cycles)
+			t->max_cycles = cycles;
+
+		if (t->frame_cycles >= t->budget)
+		{
+			t->exhausted++;
+			more = 0;
+		}
+		if (!more)
+			task_pending &= ~(1<<i);
+		break;
+	}
+
+	task_busy = 0;
+}
+
+/*
+================
+Task_Frame
+
+Folds the last frame into the totals and re-arms every task
+================
+*/
+void Task_Frame (void)
+{
+	int		i;
+	task_t	*t;
+
+	for (i=0, t=tasks ; i<task_count ; i++, t++)
+	{
+		t->total_cycles += t->frame_cycles;
+		t->total_runs += t->frame_runs;
+		t->frame_cycles = 0;
+		t->frame_runs = 0;
+	}
+	task_frames++;
+
+	if (task_idle.value)
+		task_pending = (1<<task_count) - 1;
+	else
+		task_pending = 0;
+}
+
+/*
+================
+Task_Register
+
+budget is the most cycles the task may take from waits in one frame
+================
+*/
+int Task_Register (char *name, taskfunc_t func, unsigned int budget)
+{
+	task_t	*t;
+
+	if (task_count == MAX_TASKS)
+		Sys_Error ("Task_Register: too many tasks");
+
+	t = &tasks[task_count];
+	memset (t, 0, sizeof(*t));
+	t->name = name;
+	t->func = func;
+	t->budget = budget;
+
+	return task_count++;
+}
+
+/*
+================
+Task_Stats_f
+
+Cycles each task reclaimed from accelerator waits, averaged per frame
+================
+*/
+static void Task_Stats_f (void)
+{
+	int		i;
+	task_t	*t;
+
+	if (!task_frames)
+		return;
+
+	Con_Printf ("task       cyc/frame  runs/frame  max step  budget  exhausted\n");
+	for (i=0, t=tasks ; i<task_count ; i++, t++)
+	{
+		Con_Printf ("%-10s %9u  %10u  %8u  %6u  %9u\n", t->name,
+				t->total_cycles / task_frames, t->total_runs / task_frames,
+				t->max_cycles, t->budget, t->exhausted);
+		t->total_cycles = 0;
+		t->total_runs = 0;
+		t->max_cycles = 0;
+		t->exhausted = 0;
+	}
+	Con_Printf ("%u frames\n", task_frames);
+	task_frames = 0;
+}
+
+void Task_Init (void)
+{
+	Cvar_RegisterVariable (&task_idle);
+	Cmd_AddCommand ("tasks", Task_Stats_f);
+}
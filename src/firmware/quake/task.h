@@ -0,0 +1,34 @@
+#ifndef TASK_H
+#define TASK_H
+
+/*
+ * Idle task queue
+ *
+ * Accelerator wait loops call Task_Idle() instead of spinning.  Each call
+ * runs at most one registered task for one short, run-to-completion step;
+ * a task keeps getting steps until it reports no more work or uses up its
+ * per-frame cycle budget.  Task_Frame() re-arms everything once per frame.
+ *
+ * Tasks must not start accelerator work of their own or touch the
+ * dataslot bridge, and must be safe to run from the middle of a frame.
+ */
+
+/* Returns nonzero while the task has more work to do this frame */
+typedef int (*taskfunc_t)(void);
+
+#define MAX_TASKS	8
+
+extern unsigned int	task_pending;	/* bit per task that may run */
+
+void Task_Init (void);
+int Task_Register (char *name, taskfunc_t func, unsigned int budget);
+void Task_Frame (void);
+void Task_RunIdle (void);
+
+static inline void Task_Idle (void)
+{
+	if (task_pending)
+		Task_RunIdle ();
+}
+
+#endif /* TASK_H */
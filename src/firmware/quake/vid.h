@@ -76,6 +76,19 @@ void	VID_Shutdown (void);
 void	VID_Update (vrect_t *rects);
 // flushes the given rectangles from the view buffer to the screen
 
+void	VID_SetViewScale (vrect_t *view, int srcwidth, int srcheight, int filter);
+// stretch the srcwidth x srcheight block at the view origin over the whole
+// view rect at scanout; applies to the next VID_Update only
+
+#define LAT_INPUT	0	// IN_Move sampled the pad
+#define LAT_SENDCMD	1	// move command sent
+#define LAT_RENDER	2	// R_RenderView started
+#define LAT_STAGES	3
+
+void	VID_LatencyMark (int stage);
+// stamps a motion-to-photon stage for the frame being built; VID_Update
+// stamps the swap and the hardware reports when the frame reaches scanout
+
 int VID_SetMode (int modenum, unsigned char *palette);
 // sets the mode; only used by the Quake engine for resetting to mode 0 (the
 // base mode) on memory allocation failures
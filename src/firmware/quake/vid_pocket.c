@@ -20,6 +20,13 @@ extern viddef_t vid;
 #define SYS_FB_SWAP         (*(volatile unsigned int *)0x40000018)
 #define SYS_PAL_INDEX       (*(volatile unsigned int *)0x40000040)
 #define SYS_PAL_DATA        (*(volatile unsigned int *)0x40000044)
+#define SYS_DYNRES_VIEW     (*(volatile unsigned int *)0x400000D8)
+#define SYS_DYNRES_SIZE     (*(volatile unsigned int *)0x400000DC)
+#define SYS_DYNRES_STEP     (*(volatile unsigned int *)0x400000E0)
+#define SYS_LAT_INPUT       (*(volatile unsigned int *)0x400000E4)
+#define SYS_LAT_SWAP        (*(volatile unsigned int *)0x400000E8)
+#define SYS_LAT_SCANOUT     (*(volatile unsigned int *)0x400000EC)
+#define SYS_LAT_SEQ         (*(volatile unsigned int *)0x400000F0)
 #define SDRAM_UC_BASE       0x50000000u
 
 #define VID_PIXELS          (BASEWIDTH * BASEHEIGHT)
@@ -31,6 +38,187 @@ static byte surfcache_storage[SURFCACHE_SIZE];
 unsigned short d_8to16table[256];
 unsigned d_8to24table[256];
 
+/* Scanout scaler window for the frame being built (0 = 1:1) */
+static unsigned int vid_dynres_view;
+static unsigned int vid_dynres_size;
+static unsigned int vid_dynres_step;
+
+/*
+ * Motion-to-photon latency.  The FPGA stamps the last CONT1 change, each
+ * swap and the vsync that puts a swapped buffer on screen, and numbers
+ * swaps so a scanout stamp can be matched to its frame.  Frames wait in
+ * lat_pend until the display sequence reaches them; one passed over was
+ * replaced in the ready slot before any vsync and never shown.
+ */
+#define LAT_PENDING     4
+#define LAT_BUCKETS     16
+#define LAT_BUCKET_MS   8
+#define LAT_CYCLES_MS   100000u     /* 100 MHz */
+#define LAT_CYCLES_US   100u
+
+typedef struct {
+    unsigned int seq;
+    unsigned int input;             /* hardware input stamp */
+    unsigned int mark[LAT_STAGES];
+    unsigned int swap;
+} latframe_t;
+
+static unsigned int lat_mark[LAT_STAGES];
+static unsigned int lat_input;      /* input stamp for the frame being built */
+static unsigned int lat_last_input; /* last input stamp already attributed */
+static int          lat_fresh;
+
+static latframe_t   lat_pend[LAT_PENDING];
+static int          lat_npend;
+
+static unsigned int lat_hist[LAT_BUCKETS];
+static unsigned int lat_stage_us[LAT_STAGES + 2];
+static unsigned int lat_samples, lat_shown, lat_dropped;
+static unsigned int lat_min_us = ~0u, lat_max_us;
+
+void VID_LatencyMark(int stage)
+{
+    unsigned int t;
+
+    lat_mark[stage] = SYS_CYCLE_LO;
+    if (stage != LAT_INPUT)
+        return;
+
+    /* Only the first frame to see a pad change gets charged for it */
+    t = SYS_LAT_INPUT;
+    if (t != lat_last_input) {
+        lat_last_input = t;
+        lat_input = t;
+        lat_fresh = 1;
+    }
+}
+
+/*
+ * Resolve pending frames against the display sequence.  Called just
+ * before a swap: the next swap replaces whatever is still ready, so
+ * anything older than the displayed frame now can never be shown.
+ */
+static void lat_resolve(void)
+{
+    unsigned int seq, disp, scanout, us;
+    latframe_t *f;
+    int i, n, b;
+
+    seq = SYS_LAT_SEQ;
+    disp = seq >> 16;
+    scanout = SYS_LAT_SCANOUT;
+
+    for (i = n = 0; i < lat_npend; i++) {
+        f = &lat_pend[i];
+        if ((short)(f->seq - disp) > 0) {
+            lat_pend[n++] = *f;         /* still ready, may yet be shown */
+            continue;
+        }
+        if (f->seq != disp) {
+            lat_dropped++;
+            continue;
+        }
+        lat_shown++;
+        if (!f->input)
+            continue;
+
+        us = (scanout - f->input) / LAT_CYCLES_US;
+        b = us / (LAT_BUCKET_MS * 1000);
+        if (b >= LAT_BUCKETS)
+            b = LAT_BUCKETS - 1;
+        lat_hist[b]++;
+        if (us < lat_min_us) lat_min_us = us;
+        if (us > lat_max_us) lat_max_us = us;
+
+        lat_stage_us[0] += (f->mark[LAT_INPUT] - f->input) / LAT_CYCLES_US;
+        lat_stage_us[1] += (f->mark[LAT_SENDCMD] - f->mark[LAT_INPUT]) / LAT_CYCLES_US;
+        lat_stage_us[2] += (f->mark[LAT_RENDER] - f->mark[LAT_SENDCMD]) / LAT_CYCLES_US;
+        lat_stage_us[3] += (f->swap - f->mark[LAT_RENDER]) / LAT_CYCLES_US;
+        lat_stage_us[4] += (scanout - f->swap) / LAT_CYCLES_US;
+        lat_samples++;
+    }
+    lat_npend = n;
+}
+
+/* Queue the frame just swapped; the oldest is given up if scanout stalls */
+static void lat_push(void)
+{
+    latframe_t *f;
+    int i;
+
+    if (lat_npend == LAT_PENDING) {
+        for (i = 1; i < LAT_PENDING; i++)
+            lat_pend[i - 1] = lat_pend[i];
+        lat_npend--;
+    }
+
+    f = &lat_pend[lat_npend++];
+    f->seq = SYS_LAT_SEQ & 0xFFFF;
+    f->swap = SYS_LAT_SWAP;
+    f->input = lat_fresh ? lat_input : 0;
+    for (i = 0; i < LAT_STAGES; i++)
+        f->mark[i] = lat_mark[i];
+    lat_fresh = 0;
+}
+
+/*
+================
+VID_Latency_f
+
+Input-to-scanout histogram for frames that carried a fresh pad change,
+with the average time spent in each stage of the pipeline
+================
+*/
+static void VID_Latency_f(void)
+{
+    static const char *stages[LAT_STAGES + 2] = {
+        "input wait", "move", "game", "render", "scanout"
+    };
+    char hashes[21];
+    unsigned int peak;
+    int i, j, bar;
+
+    Con_Printf("%u frames shown, %u dropped by the triple buffer\n",
+               lat_shown, lat_dropped);
+    if (!lat_samples) {
+        Con_Printf("no input changes measured\n");
+        return;
+    }
+
+    Con_Printf("input to scanout: %u samples, %.1f - %.1f ms\n", lat_samples,
+               lat_min_us / 1000.0f, lat_max_us / 1000.0f);
+
+    peak = 1;
+    for (i = 0; i < LAT_BUCKETS; i++)
+        if (lat_hist[i] > peak)
+            peak = lat_hist[i];
+
+    for (i = 0; i < LAT_BUCKETS; i++) {
+        if (!lat_hist[i])
+            continue;
+        bar = (lat_hist[i] * 20 + peak - 1) / peak;
+        for (j = 0; j < bar; j++)
+            hashes[j] = '#';
+        hashes[bar] = 0;
+        if (i == LAT_BUCKETS - 1)
+            Con_Printf("%3d+    ms %5u %s\n", i * LAT_BUCKET_MS, lat_hist[i],
+                       hashes);
+        else
+            Con_Printf("%3d-%-3d ms %5u %s\n", i * LAT_BUCKET_MS,
+                       (i + 1) * LAT_BUCKET_MS, lat_hist[i], hashes);
+    }
+
+    for (i = 0; i < LAT_STAGES + 2; i++)
+        Con_Printf("%-10s %6.2f ms\n", stages[i],
+                   lat_stage_us[i] / (float)lat_samples / 1000.0f);
+
+    memset(lat_hist, 0, sizeof(lat_hist));
+    memset(lat_stage_us, 0, sizeof(lat_stage_us));
+    lat_samples = lat_shown = lat_dropped = 0;
+    lat_min_us = ~0u;
+    lat_max_us = 0;
+}
+
 /* Get CPU byte address of the current draw framebuffer */
 static byte *fb_draw_buffer(void)
 {
@@ -135,6 +323,8 @@ void VID_Init(unsigned char *palette)
     }
 #endif
 
+    Cmd_AddCommand("latency", VID_Latency_f);
+
     SYS_DISPLAY_MODE = 1;
     Sys_Printf("VID_Init: done\n");
 }
@@ -144,13 +334,51 @@ void VID_Shutdown(void)
     SYS_DISPLAY_MODE = 0;
 }
 
+/*
+ * Dynamic resolution: the renderer drew only srcwidth x srcheight at the
+ * origin of the view rect.  Scanout stretches it back over the full view
+ * (steps are source/output in 0.16), leaving everything else 1:1.
+ */
+void VID_SetViewScale(vrect_t *view, int srcwidth, int srcheight, int filter)
+{
+    unsigned int step_x, step_y;
+
+    if (srcwidth >= view->width && srcheight >= view->height) {
+        vid_dynres_view = 0;
+        return;
+    }
+
+    /* 1.0 does not fit in 0.16; 0xFFFF is within a pixel over 320 */
+    step_x = ((unsigned)srcwidth << 16) / view->width;
+    step_y = ((unsigned)srcheight << 16) / view->height;
+    if (step_x > 0xFFFF) step_x = 0xFFFF;
+    if (step_y > 0xFFFF) step_y = 0xFFFF;
+
+    vid_dynres_view = 0x80000000u | (filter ? 0x40000000u : 0) |
+                      ((unsigned)view->y << 16) | (unsigned)view->x;
+    /* Source width bounds the filter's second tap at the rendered edge */
+    vid_dynres_size = ((unsigned)view->height << 24) |
+                      ((unsigned)srcwidth << 9) | (unsigned)view->width;
+    vid_dynres_step = (step_y << 16) | step_x;
+}
+
 void VID_Update(vrect_t *rects)
 {
     (void)rects;
 
+    /* Scaler window travels with this buffer through ready → display */
+    SYS_DYNRES_VIEW = vid_dynres_view;
+    SYS_DYNRES_SIZE = vid_dynres_size;
+    SYS_DYNRES_STEP = vid_dynres_step;
+    vid_dynres_view = 0;
+
+    lat_resolve();
+
     /* Triple buffer: mark draw buffer as ready, FPGA assigns new draw buffer.
      * Never blocks — VID_WaitSync just reads the new draw target. */
     SYS_FB_SWAP = 1;
+
+    lat_push();
 }
 
 /*
@@ -44,6 +44,11 @@ typedef struct
 
 int SV_HullPointContents (hull_t *hull, int num, vec3_t p);
 
+cvar_t	sv_hullcheck = {"sv_hullcheck", "0"};	// run the recursive tracer too and compare
+cvar_t	sv_tracecache = {"sv_tracecache", "0"};
+
+void SV_InvalidateTraceCache (void);
+
 /*
 ===============================================================================
 
@@ -55,6 +60,7 @@ HULL BOXES
 
 static	hull_t		box_hull;
 static	dclipnode_t	box_clipnodes[6];
+static	mclipnode_t	box_cnodes[6];
 static	mplane_t	box_planes[6];
 
 /*
@@ -71,6 +77,7 @@ void SV_InitBoxHull (void)
 	int		side;
 
 	box_hull.clipnodes = box_clipnodes;
+	box_hull.cnodes = box_cnodes;
 	box_hull.planes = box_planes;
 	box_hull.firstclipnode = 0;
 	box_hull.lastclipnode = 5;
@@ -89,6 +96,11 @@ void SV_InitBoxHull (void)
 		
 		box_planes[i].type = i>>1;
 		box_planes[i].normal[i>>1] = 1;
+
+		box_cnodes[i].children[0] = box_clipnodes[i].children[0];
+		box_cnodes[i].children[1] = box_clipnodes[i].children[1];
+		box_cnodes[i].type = i>>1;
+		box_cnodes[i].planenum = i;
 	}
 	
 }
@@ -111,6 +123,13 @@ hull_t	*SV_HullForBox (vec3_t mins, vec3_t maxs)
 	box_planes[4].dist = maxs[2];
 	box_planes[5].dist = mins[2];
 
+	box_cnodes[0].dist = maxs[0];
+	box_cnodes[1].dist = mins[0];
+	box_cnodes[2].dist = maxs[1];
+	box_cnodes[3].dist = mins[1];
+	box_cnodes[4].dist = maxs[2];
+	box_cnodes[5].dist = mins[2];
+
 	return &box_hull;
 }
 
@@ -247,6 +266,7 @@ SV_ClearWorld
 void SV_ClearWorld (void)
 {
 	SV_InitBoxHull ();
+	SV_InvalidateTraceCache ();
 	
 	memset (sv_areanodes, 0, sizeof(sv_areanodes));
 	sv_numareanodes = 0;
@@ -262,10 +282,15 @@ SV_UnlinkEdict
 */
 void SV_UnlinkEdict (edict_t *ent)
 {
-	if (!ent->area.prev)
+	areaproxy_t	*proxy;
+
+	proxy = &sv.areaproxies[NUM_FOR_EDICT(ent)];
+	if (!proxy->area.prev)
 		return;		// not linked in anywhere
-	RemoveLink (&ent->area);
-	ent->area.prev = ent->area.next = NULL;
+	if (proxy->solidlist)
+		SV_InvalidateTraceCache ();	// was in a solid list
+	RemoveLink (&proxy->area);
+	proxy->area.prev = proxy->area.next = NULL;
 }
 
 
@@ -277,6 +302,7 @@ SV_TouchLinks
 void SV_TouchLinks ( edict_t *ent, areanode_t *node )
 {
 	link_t		*l, *next;
+	areaproxy_t	*proxy;
 	edict_t		*touch;
 	int			old_self, old_other;
 
@@ -284,18 +310,19 @@ void SV_TouchLinks ( edict_t *ent, areanode_t *node )
 	for (l = node->trigger_edicts.next ; l != &node->trigger_edicts ; l = next)
 	{
 		next = l->next;
-		touch = EDICT_FROM_AREA(l);
+		proxy = PROXY_FROM_AREA(l);
+		if (ent->v.absmin[0] > proxy->absmax[0]
+		|| ent->v.absmin[1] > proxy->absmax[1]
+		|| ent->v.absmin[2] > proxy->absmax[2]
+		|| ent->v.absmax[0] < proxy->absmin[0]
+		|| ent->v.absmax[1] < proxy->absmin[1]
+		|| ent->v.absmax[2] < proxy->absmin[2] )
+			continue;
+		touch = proxy->ent;
 		if (touch == ent)
 			continue;
 		if (!touch->v.touch || touch->v.solid != SOLID_TRIGGER)
 			continue;
-		if (ent->v.absmin[0] > touch->v.absmax[0]
-		|| ent->v.absmin[1] > touch->v.absmax[1]
-		|| ent->v.absmin[2] > touch->v.absmax[2]
-		|| ent->v.absmax[0] < touch->v.absmin[0]
-		|| ent->v.absmax[1] < touch->v.absmin[1]
-		|| ent->v.absmax[2] < touch->v.absmin[2] )
-			continue;
 		old_self = pr_global_struct->self;
 		old_other = pr_global_struct->other;
 
@@ -372,8 +399,10 @@ SV_LinkEdict
 void SV_LinkEdict (edict_t *ent, qboolean touch_triggers)
 {
 	areanode_t	*node;
+	areaproxy_t	*proxy;
 
-	if (ent->area.prev)
+	proxy = &sv.areaproxies[NUM_FOR_EDICT(ent)];
+	if (proxy->area.prev)
 		SV_UnlinkEdict (ent);	// unlink from old position
 		
 	if (ent == sv.edicts)
@@ -460,10 +489,18 @@ void SV_LinkEdict (edict_t *ent, qboolean touch_triggers)
 	
 // link it in	
 
-	if (ent->v.solid == SOLID_TRIGGER)
-		InsertLinkBefore (&ent->area, &node->trigger_edicts);
+	VectorCopy (ent->v.absmin, proxy->absmin);
+	VectorCopy (ent->v.absmax, proxy->absmax);
+	proxy->ent = ent;
+
+	proxy->solidlist = (ent->v.solid != SOLID_TRIGGER);
+	if (!proxy->solidlist)
+		InsertLinkBefore (&proxy->area, &node->trigger_edicts);
 	else
-		InsertLinkBefore (&ent->area, &node->solid_edicts);
+	{
+		InsertLinkBefore (&proxy->area, &node->solid_edicts);
+		SV_InvalidateTraceCache ();
+	}
 	
 // if touch_triggers, touch all entities at this node and decend for more
 	if (touch_triggers)
@@ -491,18 +528,20 @@ SV_HullPointContents
 PQ_FASTTEXT int SV_HullPointContents (hull_t *hull, int num, vec3_t p)
 {
 	float		d;
-	dclipnode_t	*node;
+	mclipnode_t	*node;
 	mplane_t	*plane;
 
 	while (num >= 0)
 	{
-		node = hull->clipnodes + num;
-		plane = hull->planes + node->planenum;
+		node = hull->cnodes + num;
 		
-		if (plane->type < 3)
-			d = p[plane->type] - plane->dist;
+		if (node->type < 3)
+			d = p[node->type] - node->dist;
 		else
-			d = DotProduct (plane->normal, p) - plane->dist;
+		{
+			plane = hull->planes + node->planenum;
+			d = DotProduct (plane->normal, p) - node->dist;
+		}
 		if (d < 0)
 			num = node->children[1];
 		else
@@ -708,6 +747,199 @@ qboolean SV_RecursiveHullCheck (hull_t *hull, int num, float p1f, float p2f, vec
 }
 
 
+/*
+==================
+SV_HullCheck
+
+SV_RecursiveHullCheck with an explicit stack and the packed clipnodes.
+A frame is pushed only where the move is split by a node; the walk
+down to the split and the "go past the node" tail call are plain loops.
+The arithmetic matches SV_RecursiveHullCheck operation for operation, so
+the two produce identical traces; sv_hullcheck compares them.
+==================
+*/
+#define	MAX_HULLSTACK	256
+
+typedef struct
+{
+	int			num;			// node that split the move
+	int			side;
+	float		p1f, p2f, midf, frac;
+	vec3_t		p1, p2, mid;
+} hullframe_t;
+
+static hullframe_t	hullstack[MAX_HULLSTACK];
+
+PQ_FASTTEXT qboolean SV_HullCheck (hull_t *hull, int num, float p1f, float p2f, vec3_t start, vec3_t end, trace_t *trace)
+{
+	mclipnode_t	*node;
+	mplane_t	*plane;
+	hullframe_t	*f;
+	float		t1, t2;
+	float		frac, midf;
+	vec3_t		p1, p2, mid;
+	int			i, side, depth;
+	qboolean	result;
+
+	VectorCopy (start, p1);
+	VectorCopy (end, p2);
+	depth = 0;
+
+descend:
+	while (num >= 0)
+	{
+		if (num < hull->firstclipnode || num > hull->lastclipnode)
+			Sys_Error ("SV_HullCheck: bad node number");
+
+	//
+	// find the point distances
+	//
+		node = hull->cnodes + num;
+
+		switch (node->type)
+		{
+		case PLANE_X:
+			t1 = p1[0] - node->dist;
+			t2 = p2[0] - node->dist;
+			break;
+		case PLANE_Y:
+			t1 = p1[1] - node->dist;
+			t2 = p2[1] - node->dist;
+			break;
+		case PLANE_Z:
+			t1 = p1[2] - node->dist;
+			t2 = p2[2] - node->dist;
+			break;
+		default:
+			plane = hull->planes + node->planenum;
+			t1 = DotProduct (plane->normal, p1) - node->dist;
+			t2 = DotProduct (plane->normal, p2) - node->dist;
+			break;
+		}
+
+		if (t1 >= 0 && t2 >= 0)
+		{
+			num = node->children[0];
+			continue;
+		}
+		if (t1 < 0 && t2 < 0)
+		{
+			num = node->children[1];
+			continue;
+		}
+
+	// put the crosspoint DIST_EPSILON pixels on the near side
+		if (t1 < 0)
+			frac = (t1 + DIST_EPSILON)/(t1-t2);
+		else
+			frac = (t1 - DIST_EPSILON)/(t1-t2);
+		if (frac < 0)
+			frac = 0;
+		if (frac > 1)
+			frac = 1;
+
+		midf = p1f + (p2f - p1f)*frac;
+		for (i=0 ; i<3 ; i++)
+			mid[i] = p1[i] + frac*(p2[i] - p1[i]);
+
+		side = (t1 < 0);
+
+		if (depth == MAX_HULLSTACK)
+			Sys_Error ("SV_HullCheck: stack overflow");
+		f = &hullstack[depth++];
+		f->num = num;
+		f->side = side;
+		f->p1f = p1f;
+		f->p2f = p2f;
+		f->midf = midf;
+		f->frac = frac;
+		VectorCopy (p1, f->p1);
+		VectorCopy (p2, f->p2);
+		VectorCopy (mid, f->mid);
+
+	// move up to the node
+		num = node->children[side];
+		p2f = midf;
+		VectorCopy (mid, p2);
+	}
+
+// check for empty
+	if (num != CONTENTS_SOLID)
+	{
+		trace->allsolid = false;
+		if (num == CONTENTS_EMPTY)
+			trace->inopen = true;
+		else
+			trace->inwater = true;
+	}
+	else
+		trace->startsolid = true;
+	result = true;
+
+// finish the far half of each split, innermost first
+	while (depth)
+	{
+		f = &hullstack[--depth];
+		if (!result)
+			continue;
+
+		node = hull->cnodes + f->num;
+		side = f->side;
+
+		if (SV_HullPointContents (hull, node->children[side^1], f->mid)
+		!= CONTENTS_SOLID)
+		{
+		// go past the node
+			num = node->children[side^1];
+			p1f = f->midf;
+			p2f = f->p2f;
+			VectorCopy (f->mid, p1);
+			VectorCopy (f->p2, p2);
+			goto descend;
+		}
+
+		result = false;
+		if (trace->allsolid)
+			continue;		// never got out of the solid area
+
+	// the other side of the node is solid, this is the impact point
+		plane = hull->planes + node->planenum;
+		if (!side)
+		{
+			VectorCopy (plane->normal, trace->plane.normal);
+			trace->plane.dist = plane->dist;
+		}
+		else
+		{
+			VectorSubtract (vec3_origin, plane->normal, trace->plane.normal);
+			trace->plane.dist = -plane->dist;
+		}
+
+		frac = f->frac;
+		midf = f->midf;
+		VectorCopy (f->mid, mid);
+		while (SV_HullPointContents (hull, hull->firstclipnode, mid)
+		== CONTENTS_SOLID)
+		{ // shouldn't really happen, but does occasionally
+			frac -= 0.1;
+			if (frac < 0)
+			{
+				Con_DPrintf ("backup past 0\n");
+				break;
+			}
+			midf = f->p1f + (f->p2f - f->p1f)*frac;
+			for (i=0 ; i<3 ; i++)
+				mid[i] = f->p1[i] + frac*(f->p2[i] - f->p1[i]);
+		}
+
+		trace->fraction = midf;
+		VectorCopy (mid, trace->endpos);
+	}
+
+	return result;
+}
+
+
 /*
 ==================
 SV_ClipMoveToEntity
@@ -759,7 +991,19 @@ trace_t SV_ClipMoveToEntity (edict_t *ent, vec3_t start, vec3_t mins, vec3_t max
 #endif
 
 // trace a line through the apropriate clipping hull
-	SV_RecursiveHullCheck (hull, hull->firstclipnode, 0, 1, start_l, end_l, &trace);
+	if (sv_hullcheck.value)
+	{
+		trace_t		ref;
+
+		ref = trace;
+		SV_RecursiveHullCheck (hull, hull->firstclipnode, 0, 1, start_l, end_l, &ref);
+		SV_HullCheck (hull, hull->firstclipnode, 0, 1, start_l, end_l, &trace);
+		if (memcmp (&ref, &trace, sizeof(trace)))
+			Con_Printf ("SV_HullCheck: mismatch at %.1f %.1f %.1f, frac %.4f/%.4f\n",
+				start_l[0], start_l[1], start_l[2], trace.fraction, ref.fraction);
+	}
+	else
+		SV_HullCheck (hull, hull->firstclipnode, 0, 1, start_l, end_l, &trace);
 
 #ifdef QUAKE2
 	// rotate endpos back to world frame of reference
@@ -811,6 +1055,7 @@ Mins and maxs enclose the entire area swept by the move
 void SV_ClipToLinks ( areanode_t *node, moveclip_t *clip )
 {
 	link_t		*l, *next;
+	areaproxy_t	*proxy;
 	edict_t		*touch;
 	trace_t		trace;
 
@@ -818,7 +1063,19 @@ void SV_ClipToLinks ( areanode_t *node, moveclip_t *clip )
 	for (l = node->solid_edicts.next ; l != &node->solid_edicts ; l = next)
 	{
 		next = l->next;
-		touch = EDICT_FROM_AREA(l);
+		proxy = PROXY_FROM_AREA(l);
+
+	// broad phase on the proxy; the entvars checks below read fields
+	// progs can change without relinking, so they stay on the edict
+		if (clip->boxmins[0] > proxy->absmax[0]
+		|| clip->boxmins[1] > proxy->absmax[1]
+		|| clip->boxmins[2] > proxy->absmax[2]
+		|| clip->boxmaxs[0] < proxy->absmin[0]
+		|| clip->boxmaxs[1] < proxy->absmin[1]
+		|| clip->boxmaxs[2] < proxy->absmin[2] )
+			continue;
+
+		touch = proxy->ent;
 		if (touch->v.solid == SOLID_NOT)
 			continue;
 		if (touch == clip->passedict)
@@ -829,14 +1086,6 @@ void SV_ClipToLinks ( areanode_t *node, moveclip_t *clip )
 		if (clip->type == MOVE_NOMONSTERS && touch->v.solid != SOLID_BSP)
 			continue;
 
-		if (clip->boxmins[0] > touch->v.absmax[0]
-		|| clip->boxmins[1] > touch->v.absmax[1]
-		|| clip->boxmins[2] > touch->v.absmax[2]
-		|| clip->boxmaxs[0] < touch->v.absmin[0]
-		|| clip->boxmaxs[1] < touch->v.absmin[1]
-		|| clip->boxmaxs[2] < touch->v.absmin[2] )
-			continue;
-
 		if (clip->passedict && clip->passedict->v.size[0] && !touch->v.size[0])
 			continue;	// points never interact
 
@@ -914,10 +1163,10 @@ boxmaxs[0] = boxmaxs[1] = boxmaxs[2] = 9999;
 
 /*
 ==================
-SV_Move
+SV_MoveUncached
 ==================
 */
-trace_t SV_Move (vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int type, edict_t *passedict)
+static trace_t SV_MoveUncached (vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int type, edict_t *passedict)
 {
 	moveclip_t	clip;
 	int			i;
@@ -957,3 +1206,112 @@ trace_t SV_Move (vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int type, e
 	return clip.trace;
 }
 
+
+/*
+===============================================================================
+
+TRACE CACHE
+
+Monster AI repeats the same traces within a frame: SV_CheckBottom corner
+probes, several monsters checking sight to the same player, movestep
+retries.  Results are kept until the frame ends or a solid entity is
+linked or unlinked.
+
+Progs that change solid, owner or origin without relinking are not
+seen until the next frame, which is why this is off by default.
+
+===============================================================================
+*/
+
+#define	TRACECACHE_SIZE	64		// direct mapped, power of two
+
+typedef struct
+{
+	vec3_t		start, end, mins, maxs;
+	int			type;
+	edict_t		*passedict;
+} tracekey_t;
+
+typedef struct
+{
+	tracekey_t	key;
+	int			gen;
+	trace_t		trace;
+} tracecache_t;
+
+static tracecache_t	sv_tracecache_ents[TRACECACHE_SIZE];
+static int			sv_tracegen = 1;
+static unsigned int	sv_tracehits, sv_tracemisses, sv_traceflushes;
+
+/*
+==================
+SV_InvalidateTraceCache
+
+Called at the start of each server frame and whenever a solid entity is
+linked or unlinked
+==================
+*/
+void SV_InvalidateTraceCache (void)
+{
+	sv_tracegen++;
+	sv_traceflushes++;
+}
+
+/*
+==================
+SV_Move
+==================
+*/
+trace_t SV_Move (vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int type, edict_t *passedict)
+{
+	tracekey_t		key;
+	tracecache_t	*tc;
+	unsigned int	h, *w;
+	int				i;
+
+	if (!sv_tracecache.value)
+		return SV_MoveUncached (start, mins, maxs, end, type, passedict);
+
+	memset (&key, 0, sizeof(key));	// memcmp'd, so no stray padding
+	VectorCopy (start, key.start);
+	VectorCopy (end, key.end);
+	VectorCopy (mins, key.mins);
+	VectorCopy (maxs, key.maxs);
+	key.type = type;
+	key.passedict = passedict;
+
+	h = 0;
+	w = (unsigned int *)&key;
+	for (i=0 ; i<sizeof(key)/4 ; i++)
+		h = (h ^ w[i]) * 0x01000193;
+	tc = &sv_tracecache_ents[(h ^ (h >> 16)) & (TRACECACHE_SIZE-1)];
+
+	if (tc->gen == sv_tracegen && !memcmp (&tc->key, &key, sizeof(key)))
+	{
+		sv_tracehits++;
+		return tc->trace;
+	}
+
+	sv_tracemisses++;
+	tc->trace = SV_MoveUncached (start, mins, maxs, end, type, passedict);
+	tc->key = key;
+	tc->gen = sv_tracegen;		// the trace itself never relinks anything
+
+	return tc->trace;
+}
+
+/*
+==================
+SV_TraceStats_f
+==================
+*/
+void SV_TraceStats_f (void)
+{
+	unsigned int	total;
+
+	total = sv_tracehits + sv_tracemisses;
+	Con_Printf ("%u traces, %u cached (%u%%), %u flushes\n", total,
+		sv_tracehits, total ? sv_tracehits * 100 / total : 0,
+		sv_traceflushes);
+	sv_tracehits = sv_tracemisses = sv_traceflushes = 0;
+}
@@ -37,6 +37,18 @@ typedef struct
 } trace_t;
 
 
+// Compact copy of the box the area node walks reject on, one per edict and
+// indexed by edict number.  SV_ClipToLinks and SV_TouchLinks only read
+// entvars for candidates whose box overlaps the query.
+typedef struct areaproxy_s
+{
+	link_t		area;				// linked to a division node or leaf
+	vec3_t		absmin, absmax;		// ent->v.absmin/absmax as of the last link
+	edict_t		*ent;
+	qboolean	solidlist;			// linked into solid_edicts, not trigger_edicts
+} areaproxy_t;
+#define	PROXY_FROM_AREA(l) STRUCT_FROM_LINK(l,areaproxy_t,area)
+
 #define	MOVE_NORMAL		0
 #define	MOVE_NOMONSTERS	1
 #define	MOVE_MISSILE	2
@@ -64,6 +76,14 @@ int SV_TruePointContents (vec3_t p);
 
 edict_t	*SV_TestEntityPosition (edict_t *ent);
 
+qboolean SV_RecursiveHullCheck (hull_t *hull, int num, float p1f, float p2f, vec3_t p1, vec3_t p2, trace_t *trace);
+qboolean SV_HullCheck (hull_t *hull, int num, float p1f, float p2f, vec3_t p1, vec3_t p2, trace_t *trace);
+// SV_HullCheck is the iterative version of SV_RecursiveHullCheck
+
+void SV_InvalidateTraceCache (void);
+// SV_Move results are reused until this is called; sv_tracecache enables it
+void SV_TraceStats_f (void);
+
 trace_t SV_Move (vec3_t start, vec3_t mins, vec3_t maxs, vec3_t end, int type, edict_t *passedict);
 // mins and maxs are reletive
 
@@ -5,11 +5,13 @@
 // interpolation, applies volume, and outputs {L16, R16} for hardware
 // mixing with CPU SFX.
 //
-// The CPU feeds raw CD samples into an internal FIFO via MMIO writes.
+// Raw CD samples reach an internal FIFO either through MUSIC_DATA MMIO
+// writes, or (ring mode) through a read master that fetches them from an
+// SDRAM ring the bridge DMAs into; the CPU then only moves WRITE_POS.
 // The resampler drains the FIFO at 44100 Hz, resamples to 48000 Hz,
 // and advances on each mix_trigger pulse (48 kHz from CPU audio writes).
 //
-// FIFO: 512 stereo frames (2KB), written by CPU via MUSIC_DATA register.
+// FIFO: 512 stereo frames (2KB).
 //
 
 `default_nettype none
@@ -30,7 +32,16 @@ module audio_cd_resampler (
     input  wire        reg_wr,
     input  wire [3:0]  reg_addr,    // Word address [5:2] of MMIO
     input  wire [31:0] reg_wdata,
-    output reg  [31:0] reg_rdata
+    output reg  [31:0] reg_rdata,
+
+    // AXI4 read master (to axi_sdram_arbiter), ring mode only
+    output reg         m_axi_arvalid,
+    input  wire        m_axi_arready,
+    output reg  [31:0] m_axi_araddr,
+    output wire [7:0]  m_axi_arlen,
+    input  wire        m_axi_rvalid,
+    input  wire [31:0] m_axi_rdata,
+    input  wire        m_axi_rlast
 );
 
 // ============================================
@@ -46,19 +57,34 @@ localparam FIFO_MASK       = FIFO_DEPTH - 1;
 // ============================================
 localparam [14:0] RESAMP_STEP = 15'd30106;
 
+// Ring fetches are 16-frame bursts; the ring size is a multiple of 16
+// and reads start at 0, so a burst never wraps.
+localparam RING_BURST = 16;
+
 // ============================================
 // Control registers (MMIO 0x4C0000xx)
-//   0x08 (addr=2): CTRL      - bit0=enable, bit1=pause
+//   0x08 (addr=2): CTRL      - bit0=enable, bit1=pause, bit2=ring mode
 //   0x0C (addr=3): VOLUME    - [8:0] = 0-256
 //   0x10 (addr=4): (unused, was WRITE_POS)
 //   0x14 (addr=5): FIFO_LEVEL - [9:0] = frames in FIFO (read-only)
 //   0x18 (addr=6): STATUS    - bit0=active, bit1=starved
 //   0x1C (addr=7): MUSIC_DATA - write raw stereo sample {R16,L16} into FIFO
+//   0x28 (addr=10): RING_BASE  - SDRAM byte address of the ring (64B aligned)
+//   0x2C (addr=11): RING_MASK  - ring size in frames - 1 (power of two)
+//   0x30 (addr=12): RING_WRITE_POS - frames landed in the ring (monotonic)
+//   0x34 (addr=13): RING_READ_POS  - frames fetched into the FIFO (read-only)
+// 0x20/0x24 decode as audio sample writes in axi_periph_slave, so the ring
+// registers start at 0x28.
 // ============================================
 reg        ctrl_enable;
 reg        ctrl_pause;
+reg        ctrl_ring;
 reg [8:0]  ctrl_volume;        // 0-256
 reg        starved;
+reg [25:0] ring_base;
+reg [15:0] ring_mask;
+reg [31:0] ring_write_pos;
+reg [31:0] ring_read_pos;
 
 // ============================================
 // Internal FIFO (infers BRAM / M10K)
@@ -72,8 +98,12 @@ wire fifo_empty = (fifo_count == 0);
 wire fifo_full  = (fifo_count == FIFO_DEPTH);
 wire [FIFO_DEPTH_BITS:0] fifo_space = FIFO_DEPTH - fifo_count;
 
-// FIFO write: from MUSIC_DATA register write
-wire fifo_push = reg_wr && (reg_addr == 4'd7) && !fifo_full;
+// FIFO write: from MUSIC_DATA register write, or from the read master's
+// R beats in ring mode (space for the whole burst is reserved at AR time)
+wire        mmio_push = reg_wr && (reg_addr == 4'd7) && !ctrl_ring;
+wire        ring_push = m_axi_rvalid && ctrl_ring;
+wire        fifo_push = (mmio_push || ring_push) && !fifo_full;
+wire [31:0] fifo_push_data = ring_push ? m_axi_rdata : reg_wdata;
 
 // FIFO read: when resampler needs next sample
 reg  fifo_pop;
@@ -83,20 +113,36 @@ always @(posedge clk) begin
     if (fifo_pop && !fifo_empty)
         fifo_rd_data <= fifo_mem[fifo_rd_ptr];
     if (fifo_push)
-        fifo_mem[fifo_wr_ptr] <= reg_wdata;
+        fifo_mem[fifo_wr_ptr] <= fifo_push_data;
 end
 
 // Register read (combinational)
 always @(*) begin
     case (reg_addr)
-        4'd2:    reg_rdata = {30'b0, ctrl_pause, ctrl_enable};
+        4'd2:    reg_rdata = {29'b0, ctrl_ring, ctrl_pause, ctrl_enable};
         4'd3:    reg_rdata = {23'b0, ctrl_volume};
         4'd5:    reg_rdata = {22'b0, fifo_count};
         4'd6:    reg_rdata = {30'b0, starved, ctrl_enable & ~ctrl_pause};
+        4'd10:   reg_rdata = {6'b0, ring_base};
+        4'd11:   reg_rdata = {16'b0, ring_mask};
+        4'd12:   reg_rdata = ring_write_pos;
+        4'd13:   reg_rdata = ring_read_pos;
         default: reg_rdata = 32'd0;
     endcase
 end
 
+// ============================================
+// Ring read master: one 16-beat burst in flight, issued only when the
+// ring holds a full burst and the FIFO has room for all of it
+// ============================================
+reg         ring_busy;
+wire [31:0] ring_avail = ring_write_pos - ring_read_pos;
+wire        ring_fetch = ctrl_enable && ctrl_ring && !ring_busy &&
+                         (ring_avail >= RING_BURST) && (fifo_space >= RING_BURST);
+wire [17:0] ring_offset = {ring_read_pos[15:0] & ring_mask, 2'b00};
+
+assign m_axi_arlen = RING_BURST - 1;
+
 // ============================================
 // Sample buffers for interpolation
 // ============================================
@@ -164,7 +210,15 @@ always @(posedge clk or negedge reset_n) begin
         music_r       <= 0;
         ctrl_enable   <= 0;
         ctrl_pause    <= 0;
+        ctrl_ring     <= 0;
         ctrl_volume   <= 9'd256;
+        ring_base     <= 0;
+        ring_mask     <= 0;
+        ring_write_pos <= 0;
+        ring_read_pos <= 0;
+        ring_busy     <= 0;
+        m_axi_arvalid <= 0;
+        m_axi_araddr  <= 0;
         fifo_wr_ptr   <= 0;
         fifo_rd_ptr   <= 0;
         fifo_count    <= 0;
@@ -195,6 +249,7 @@ always @(posedge clk or negedge reset_n) begin
                 4'd2: begin // CTRL
                     ctrl_enable <= reg_wdata[0];
                     ctrl_pause  <= reg_wdata[1];
+                    ctrl_ring   <= reg_wdata[2];
                     // Enable rising edge: reset state
                     if (reg_wdata[0] && !ctrl_enable) begin
                         resample_frac <= 0;
@@ -206,6 +261,7 @@ always @(posedge clk or negedge reset_n) begin
                         fifo_wr_ptr   <= 0;
                         fifo_count    <= 0;
                         starved       <= 0;
+                        ring_read_pos <= 0;
                     end
                     if (!reg_wdata[0]) begin
                         state   <= S_IDLE;
@@ -214,9 +270,26 @@ always @(posedge clk or negedge reset_n) begin
                     end
                 end
                 4'd3: ctrl_volume <= reg_wdata[8:0];
+                4'd10: ring_base <= {reg_wdata[25:6], 6'b0};
+                4'd11: ring_mask <= reg_wdata[15:0];
+                4'd12: ring_write_pos <= reg_wdata;
             endcase
         end
 
+        // ============================================
+        // Ring read master
+        // ============================================
+        if (m_axi_arvalid && m_axi_arready)
+            m_axi_arvalid <= 0;
+        if (ring_busy && m_axi_rvalid && m_axi_rlast)
+            ring_busy <= 0;
+        if (ring_fetch) begin
+            m_axi_arvalid <= 1;
+            m_axi_araddr  <= {6'b0, ring_base + {8'b0, ring_offset}};
+            ring_read_pos <= ring_read_pos + RING_BURST;
+            ring_busy     <= 1;
+        end
+
         // ============================================
         // FSM
         // ============================================
@@ -88,6 +88,11 @@ module axi_periph_slave #(
     output wire        display_mode,
     output wire [24:0] fb_display_addr,
 
+    // Dynamic resolution window for the buffer being scanned out
+    output wire [31:0] dynres_view,     // [8:0] x0, [23:16] y0, [30] filter, [31] enable
+    output wire [31:0] dynres_size,     // [8:0] out width, [17:9] source width, [31:24] out height
+    output wire [31:0] dynres_step,     // [15:0] x step, [31:16] y step (0.16 source/output)
+
     // Palette write interface
     output reg         pal_wr,
     output reg  [7:0]  pal_addr,
@@ -340,6 +345,34 @@ function [24:0] fb_addr;
     endcase
 endfunction
 
+// Dynamic resolution window: written for the draw buffer, follows it through
+// ready → display so the scaler always matches the frame being scanned out
+reg [31:0] dr_pend_view, dr_pend_size, dr_pend_step;
+reg [31:0] dr_ready_view, dr_ready_size, dr_ready_step;
+reg [31:0] dr_disp_view, dr_disp_size, dr_disp_step;
+
+// Latency timestamps (cycle_counter[31:0]) for motion-to-photon measurement.
+// Swap sequence numbers follow each frame through ready → display, like the
+// dynres window, so firmware can tell which frame a scanout stamp belongs to.
+reg [31:0] lat_input_ts;     // last CONT1 key change or stick move
+reg [31:0] lat_swap_ts;      // last SYS_FB_SWAP
+reg [31:0] lat_scanout_ts;   // vsync that put the ready frame on screen
+reg [15:0] lat_swap_seq, lat_ready_seq, lat_disp_seq;
+reg [31:0] lat_prev_key;
+reg [31:0] lat_prev_joy;     // stick axes at the last stamp
+
+// Stick axes only count as input once one moves past a dead-band from
+// where it was at the last stamp, so jitter does not keep re-stamping
+localparam LAT_JOY_DEADBAND = 8'd8;
+
+function axis_moved;
+    input [7:0] a, b;
+    begin
+        axis_moved = (a > b) ? (a - b > LAT_JOY_DEADBAND)
+                             : (b - a > LAT_JOY_DEADBAND);
+    end
+endfunction
+
 wire [24:0] fb_display_addr_reg = fb_addr(fb_display_idx);
 wire [24:0] fb_draw_addr_reg = fb_addr(fb_draw_idx);
 
@@ -355,6 +388,9 @@ endfunction
 
 assign display_mode = display_mode_reg;
 assign fb_display_addr = fb_display_addr_reg;
+assign dynres_view = dr_disp_view;
+assign dynres_size = dr_disp_size;
+assign dynres_step = dr_disp_step;
 
 // ============================================
 // CDC synchronizers
@@ -409,6 +445,11 @@ synch_3 #(.WIDTH(32)) s_cont2_key(.i(cont2_key), .o(cont2_key_s), .clk(clk), .ri
 synch_3 #(.WIDTH(32)) s_cont2_joy(.i(cont2_joy), .o(cont2_joy_s), .clk(clk), .rise(), .fall());
 synch_3 #(.WIDTH(16)) s_cont2_trig(.i(cont2_trig), .o(cont2_trig_s), .clk(clk), .rise(), .fall());
 synch_3 #(.WIDTH(32)) s_cont1_joy(.i(cont1_joy), .o(cont1_joy_s), .clk(clk), .rise(), .fall());
+
+wire lat_joy_moved = axis_moved(cont1_joy_s[7:0],   lat_prev_joy[7:0])   ||
+                     axis_moved(cont1_joy_s[15:8],  lat_prev_joy[15:8])  ||
+                     axis_moved(cont1_joy_s[23:16], lat_prev_joy[23:16]) ||
+                     axis_moved(cont1_joy_s[31:24], lat_prev_joy[31:24]);
 synch_3 #(.WIDTH(16)) s_cont1_trig(.i(cont1_trig), .o(cont1_trig_s), .clk(clk), .rise(), .fall());
 
 // Analogizer SNAC controller state (directly in CPU clock domain from Analogizer module)
@@ -470,6 +511,23 @@ always @(posedge clk) begin
         fb_display_idx <= 2'd0;
         fb_ready_idx <= 2'd3;  // 3 = none ready
         fb_draw_idx <= 2'd1;
+        dr_pend_view <= 0;
+        dr_pend_size <= 0;
+        dr_pend_step <= 0;
+        dr_ready_view <= 0;
+        dr_ready_size <= 0;
+        dr_ready_step <= 0;
+        dr_disp_view <= 0;
+        dr_disp_size <= 0;
+        dr_disp_step <= 0;
+        lat_input_ts <= 0;
+        lat_swap_ts <= 0;
+        lat_scanout_ts <= 0;
+        lat_swap_seq <= 0;
+        lat_ready_seq <= 0;
+        lat_disp_seq <= 0;
+        lat_prev_key <= 0;
+        lat_prev_joy <= 0;
         pal_wr <= 0;
         pal_addr <= 0;
         pal_data <= 0;
@@ -493,6 +551,12 @@ always @(posedge clk) begin
         cycle_counter <= cycle_counter + 1;
         pal_wr <= 0;
 
+        lat_prev_key <= cont1_key_s;
+        if (cont1_key_s != lat_prev_key || lat_joy_moved) begin
+            lat_input_ts <= cycle_counter[31:0];
+            lat_prev_joy <= cont1_joy_s;
+        end
+
         if (target_ack_s) begin
             target_dataslot_read <= 0;
             target_dataslot_write <= 0;
@@ -507,6 +571,12 @@ always @(posedge clk) begin
                     // Draw buffer complete → ready; assign free buffer as new draw
                     fb_ready_idx <= fb_draw_idx;
                     fb_draw_idx <= fb_free(fb_display_idx, fb_draw_idx);
+                    dr_ready_view <= dr_pend_view;
+                    dr_ready_size <= dr_pend_size;
+                    dr_ready_step <= dr_pend_step;
+                    lat_swap_ts <= cycle_counter[31:0];
+                    lat_swap_seq <= lat_swap_seq + 1'd1;
+                    lat_ready_seq <= lat_swap_seq + 1'd1;
                 end
                 6'b001000: ds_slot_id_reg <= req_wdata[15:0];
                 6'b001001: ds_slot_offset_reg <= req_wdata;
@@ -544,6 +614,9 @@ always @(posedge clk) begin
                     mtimecmp_reg <= req_wdata;
                     mtimecmp_armed <= 1;
                 end
+                6'b110110: dr_pend_view <= req_wdata;  // 0xD8 DYNRES_VIEW
+                6'b110111: dr_pend_size <= req_wdata;  // 0xDC DYNRES_SIZE
+                6'b111000: dr_pend_step <= req_wdata;  // 0xE0 DYNRES_STEP
                 default: ;
             endcase
         end
@@ -552,6 +625,11 @@ always @(posedge clk) begin
         if (fb_ready_idx != 2'd3 && vsync_rising) begin
             fb_display_idx <= fb_ready_idx;
             fb_ready_idx <= 2'd3;  // consumed
+            dr_disp_view <= dr_ready_view;
+            dr_disp_size <= dr_ready_size;
+            dr_disp_step <= dr_ready_step;
+            lat_scanout_ts <= cycle_counter[31:0];
+            lat_disp_seq <= lat_ready_seq;
         end
     end
 end
@@ -612,6 +690,13 @@ always @(*) begin
         6'b110011: sysreg_rdata = perf_dcache_miss;     // 0xCC PERF_DCACHE_MISS
         6'b110100: sysreg_rdata = perf_icache_stall;    // 0xD0 PERF_ICACHE_STALL
         6'b110101: sysreg_rdata = perf_dcache_stall;    // 0xD4 PERF_DCACHE_STALL
+        6'b110110: sysreg_rdata = dr_pend_view;         // 0xD8 DYNRES_VIEW
+        6'b110111: sysreg_rdata = dr_pend_size;         // 0xDC DYNRES_SIZE
+        6'b111000: sysreg_rdata = dr_pend_step;         // 0xE0 DYNRES_STEP
+        6'b111001: sysreg_rdata = lat_input_ts;         // 0xE4 LAT_INPUT
+        6'b111010: sysreg_rdata = lat_swap_ts;          // 0xE8 LAT_SWAP
+        6'b111011: sysreg_rdata = lat_scanout_ts;       // 0xEC LAT_SCANOUT
+        6'b111100: sysreg_rdata = {lat_disp_seq, lat_swap_seq}; // 0xF0 LAT_SEQ
         default: sysreg_rdata = 32'h0;
     endcase
 end
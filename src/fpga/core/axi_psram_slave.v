@@ -3,6 +3,8 @@
 //
 // Converts AXI4 transactions to the psram_controller word-level protocol.
 // Reads use sync burst mode for entire AXI burst (1 hardware burst per AXI read).
+// When the controller is idle the burst is issued in the same cycle the AR is
+// accepted, so a cache refill does not spend a cycle in S_RD_BURST.
 // Writes still use single-word async operations (PSRAM has no burst write).
 //
 // Protocol:
@@ -135,7 +137,15 @@ always @(posedge clk or posedge reset) begin
                 addr_r <= s_axi_araddr;
                 burst_len <= s_axi_arlen;
                 beat_count <= 0;
-                state <= S_RD_BURST;
+                if (!psram_busy) begin
+                    psram_burst_rd <= 1;
+                    psram_addr <= s_axi_araddr[23:2];
+                    psram_burst_len <= s_axi_arlen[5:0];
+                    cmd_issued <= 1;
+                    state <= S_RD_STREAM;
+                end else begin
+                    state <= S_RD_BURST;
+                end
             end else if (s_axi_awvalid) begin
                 s_axi_awready <= 1;
                 addr_r <= s_axi_awaddr;
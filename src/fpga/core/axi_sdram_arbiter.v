@@ -1,8 +1,10 @@
 //
-// AXI4 SDRAM Arbiter — 4 Masters, Fixed Priority
+// AXI4 SDRAM Arbiter — 5 Masters, Fixed Priority
 //
-// Routes 4 AXI4 masters to 1 AXI4 slave (axi_sdram_slave).
-// Fixed priority: M0 (Span) > M1 (DMA) > M2 (CPU) > M3 (Bridge).
+// Routes 5 AXI4 masters to 1 AXI4 slave (axi_sdram_slave).
+// Fixed priority: M4 (CD audio) > M0 (Span) > M1 (DMA) > M2 (CPU) > M3 (Bridge).
+// M4 is read-only and goes first: it issues one 16-beat burst per ~360 us
+// and its FIFO only covers ~10 ms of audio.
 // Single outstanding transaction — grants one master at a time,
 // holds until read completes (R.rlast) or write completes (B.bvalid).
 //
@@ -99,6 +101,16 @@ module axi_sdram_arbiter (
     output wire        m3_bvalid,
     output wire [1:0]  m3_bresp,
 
+    // Master 4: CD audio ring read master (read-only, highest priority)
+    input  wire        m4_arvalid,
+    output wire        m4_arready,
+    input  wire [31:0] m4_araddr,
+    input  wire [7:0]  m4_arlen,
+    output wire        m4_rvalid,
+    output wire [31:0] m4_rdata,
+    output wire [1:0]  m4_rresp,
+    output wire        m4_rlast,
+
     // Slave port (to axi_sdram_slave)
     output wire        s_arvalid,
     input  wire        s_arready,
@@ -129,7 +141,7 @@ localparam ST_RD   = 2'd1;  // Read transaction active (AR→R)
 localparam ST_WR   = 2'd2;  // Write transaction active (AW→W→B)
 
 reg [1:0] arb_state;
-reg [1:0] grant;  // 0=M0(Span), 1=M1(DMA), 2=M2(CPU), 3=M3(Bridge)
+reg [2:0] grant;  // 0=M0(Span), 1=M1(DMA), 2=M2(CPU), 3=M3(Bridge), 4=M4(CD audio)
 
 // Grant arbitration — registered for timing
 always @(posedge clk or posedge reset) begin
@@ -139,30 +151,33 @@ always @(posedge clk or posedge reset) begin
     end else begin
         case (arb_state)
         ST_IDLE: begin
-            // Fixed priority: M0 > M1 > M2 > M3, reads before writes within a master
-            if (m0_arvalid) begin
-                grant <= 2'd0;
+            // Fixed priority: M4 > M0 > M1 > M2 > M3, reads before writes within a master
+            if (m4_arvalid) begin
+                grant <= 3'd4;
+                arb_state <= ST_RD;
+            end else if (m0_arvalid) begin
+                grant <= 3'd0;
                 arb_state <= ST_RD;
             end else if (m0_awvalid) begin
-                grant <= 2'd0;
+                grant <= 3'd0;
                 arb_state <= ST_WR;
             end else if (m1_arvalid) begin
-                grant <= 2'd1;
+                grant <= 3'd1;
                 arb_state <= ST_RD;
             end else if (m1_awvalid) begin
-                grant <= 2'd1;
+                grant <= 3'd1;
                 arb_state <= ST_WR;
             end else if (m2_arvalid) begin
-                grant <= 2'd2;
+                grant <= 3'd2;
                 arb_state <= ST_RD;
             end else if (m2_awvalid) begin
-                grant <= 2'd2;
+                grant <= 3'd2;
                 arb_state <= ST_WR;
             end else if (m3_arvalid) begin
-                grant <= 2'd3;
+                grant <= 3'd3;
                 arb_state <= ST_RD;
             end else if (m3_awvalid) begin
-                grant <= 2'd3;
+                grant <= 3'd3;
                 arb_state <= ST_WR;
             end
         end
@@ -187,10 +202,11 @@ end
 // ============================================
 // Master → Slave channel mux (combinational)
 // ============================================
-wire grant_m0 = (grant == 2'd0);
-wire grant_m1 = (grant == 2'd1);
-wire grant_m2 = (grant == 2'd2);
-wire grant_m3 = (grant == 2'd3);
+wire grant_m0 = (grant == 3'd0);
+wire grant_m1 = (grant == 3'd1);
+wire grant_m2 = (grant == 3'd2);
+wire grant_m3 = (grant == 3'd3);
+wire grant_m4 = (grant == 3'd4);
 wire active_rd = (arb_state == ST_RD);
 wire active_wr = (arb_state == ST_WR);
 wire active = active_rd | active_wr;
@@ -204,14 +220,15 @@ wire rd_completing = active_rd && s_rvalid && s_rlast;
 wire wr_completing = active_wr && s_bvalid;
 
 // AR channel — masked on rlast to prevent slave from accepting a new read
-assign s_arvalid = (active_rd && !rd_completing) ? (grant_m0 ? m0_arvalid :
+assign s_arvalid = (active_rd && !rd_completing) ? (grant_m4 ? m4_arvalid :
+                                                     grant_m0 ? m0_arvalid :
                                                      grant_m1 ? m1_arvalid :
                                                      grant_m2 ? m2_arvalid :
                                                                 m3_arvalid) : 1'b0;
-assign s_araddr  = grant_m0 ? m0_araddr  : grant_m1 ? m1_araddr  :
-                   grant_m2 ? m2_araddr  : m3_araddr;
-assign s_arlen   = grant_m0 ? m0_arlen   : grant_m1 ? m1_arlen   :
-                   grant_m2 ? m2_arlen   : m3_arlen;
+assign s_araddr  = grant_m4 ? m4_araddr  : grant_m0 ? m0_araddr  :
+                   grant_m1 ? m1_araddr  : grant_m2 ? m2_araddr  : m3_araddr;
+assign s_arlen   = grant_m4 ? m4_arlen   : grant_m0 ? m0_arlen   :
+                   grant_m1 ? m1_arlen   : grant_m2 ? m2_arlen   : m3_arlen;
 
 // AW channel — masked on bvalid to prevent slave from accepting a new write
 assign s_awvalid = (active_wr && !wr_completing) ? (grant_m0 ? m0_awvalid :
@@ -244,24 +261,29 @@ assign m0_arready = (active_rd && grant_m0) ? s_arready : 1'b0;
 assign m1_arready = (active_rd && grant_m1) ? s_arready : 1'b0;
 assign m2_arready = (active_rd && grant_m2) ? s_arready : 1'b0;
 assign m3_arready = (active_rd && grant_m3) ? s_arready : 1'b0;
+assign m4_arready = (active_rd && grant_m4) ? s_arready : 1'b0;
 
 // R channel — only to granted master during read
 assign m0_rvalid = (active_rd && grant_m0) ? s_rvalid : 1'b0;
 assign m1_rvalid = (active_rd && grant_m1) ? s_rvalid : 1'b0;
 assign m2_rvalid = (active_rd && grant_m2) ? s_rvalid : 1'b0;
 assign m3_rvalid = (active_rd && grant_m3) ? s_rvalid : 1'b0;
+assign m4_rvalid = (active_rd && grant_m4) ? s_rvalid : 1'b0;
 assign m0_rdata  = s_rdata;  // Broadcast data (only valid matters)
 assign m1_rdata  = s_rdata;
 assign m2_rdata  = s_rdata;
 assign m3_rdata  = s_rdata;
+assign m4_rdata  = s_rdata;
 assign m0_rresp  = s_rresp;
 assign m1_rresp  = s_rresp;
 assign m2_rresp  = s_rresp;
 assign m3_rresp  = s_rresp;
+assign m4_rresp  = s_rresp;
 assign m0_rlast  = s_rlast;
 assign m1_rlast  = s_rlast;
 assign m2_rlast  = s_rlast;
 assign m3_rlast  = s_rlast;
+assign m4_rlast  = s_rlast;
 
 // AW ready — only to granted master during write
 assign m0_awready = (active_wr && grant_m0) ? s_awready : 1'b0;
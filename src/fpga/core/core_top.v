@@ -940,6 +940,14 @@ wire [3:0]  arb_s_wstrb;
 wire        arb_s_bvalid;
 wire [1:0]  arb_s_bresp;
 
+// CD audio ring read master (from audio_cd_resampler to axi_sdram_arbiter M4)
+wire        music_m_arvalid, music_m_arready;
+wire [31:0] music_m_araddr;
+wire [7:0]  music_m_arlen;
+wire        music_m_rvalid, music_m_rlast;
+wire [31:0] music_m_rdata;
+wire [1:0]  music_m_rresp;
+
 // Bridge AXI4 master (from axi_bridge_master to axi_sdram_arbiter M3)
 wire        bridge_m_arvalid, bridge_m_arready;
 wire [31:0] bridge_m_araddr;
@@ -1804,17 +1812,20 @@ assign video_hs = vidout_hs;
     // Display mode and framebuffer address from CPU
     wire display_mode;
     wire [24:0] fb_display_addr;
+    wire [31:0] dynres_view;
+    wire [31:0] dynres_size;
+    wire [31:0] dynres_step;
 
     // Timer interrupt (from axi_periph_slave mtimecmp comparator)
     wire timer_irq;
 
     // VexiiRiscv CPU system - running at 100 MHz (CPU + memory)
     // Pure bus routing: VexiiRiscv → arbiter → {SDRAM, PSRAM, Local} AXI4 masters
-    // CPU performance counters (not available from cpu_system, stub for sysreg)
-    wire [31:0] cpu_perf_icache_miss  = 32'd0;
-    wire [31:0] cpu_perf_dcache_miss  = 32'd0;
-    wire [31:0] cpu_perf_icache_stall = 32'd0;
-    wire [31:0] cpu_perf_dcache_stall = 32'd0;
+    // CPU cache refill counters (cpu_system → sysreg PERF_*CACHE_*)
+    wire [31:0] cpu_perf_icache_miss;
+    wire [31:0] cpu_perf_dcache_miss;
+    wire [31:0] cpu_perf_icache_stall;
+    wire [31:0] cpu_perf_dcache_stall;
 
     cpu_system cpu (
         .clk(clk_cpu),  // 100 MHz
@@ -1879,7 +1890,11 @@ assign video_hs = vidout_hs;
         .m_local_wlast(cpu_m_local_wlast),
         .m_local_bvalid(cpu_m_local_bvalid),
         .m_local_bresp(cpu_m_local_bresp),
-        .timer_irq(timer_irq)
+        .timer_irq(timer_irq),
+        .perf_icache_miss(cpu_perf_icache_miss),
+        .perf_dcache_miss(cpu_perf_dcache_miss),
+        .perf_icache_stall(cpu_perf_icache_stall),
+        .perf_dcache_stall(cpu_perf_dcache_stall)
     );
 
     // AXI4 peripheral slave: BRAM, colormap, system registers, CDC, terminal,
@@ -1950,6 +1965,9 @@ assign video_hs = vidout_hs;
         // Display control
         .display_mode(display_mode),
         .fb_display_addr(fb_display_addr),
+        .dynres_view(dynres_view),
+        .dynres_size(dynres_size),
+        .dynres_step(dynres_step),
         // Palette write interface
         .pal_wr(cpu_pal_wr),
         .pal_addr(cpu_pal_addr),
@@ -2099,7 +2117,7 @@ assign video_hs = vidout_hs;
     );
 
     // AXI4 slave wrapper: CPU AXI4 → SDRAM word-level interface
-    // AXI4 SDRAM arbiter: Span(M0) > DMA(M1) > CPU(M2) > Bridge(M3) → slave
+    // AXI4 SDRAM arbiter: CD audio(M4) > Span(M0) > DMA(M1) > CPU(M2) > Bridge(M3) → slave
     // Span, DMA, and Bridge now have native AXI4 master ports
     axi_sdram_arbiter sdram_arb (
         .clk(clk_cpu),
@@ -2148,6 +2166,11 @@ assign video_hs = vidout_hs;
         .m3_wdata(bridge_m_wdata),     .m3_wstrb(bridge_m_wstrb),
         .m3_wlast(bridge_m_wlast),
         .m3_bvalid(bridge_m_bvalid),   .m3_bresp(bridge_m_bresp),
+        // M4: CD audio ring read master (read-only, highest priority)
+        .m4_arvalid(music_m_arvalid), .m4_arready(music_m_arready),
+        .m4_araddr(music_m_araddr),   .m4_arlen(music_m_arlen),
+        .m4_rvalid(music_m_rvalid),   .m4_rdata(music_m_rdata),
+        .m4_rresp(music_m_rresp),     .m4_rlast(music_m_rlast),
         // Slave output (to axi_sdram_slave)
         .s_arvalid(arb_s_arvalid), .s_arready(arb_s_arready),
         .s_araddr(arb_s_araddr),   .s_arlen(arb_s_arlen),
@@ -2371,6 +2394,16 @@ assign video_hs = vidout_hs;
         .line_start(line_start),
         .pixel_color(framebuffer_pixel_color),
         .fb_base_addr(fb_display_addr),  // 25-bit SDRAM 16-bit word address
+        // Dynamic resolution window (quasi-static, changes only at vsync)
+        .dr_enable(dynres_view[31]),
+        .dr_filter(dynres_view[30]),
+        .dr_x0(dynres_view[8:0]),
+        .dr_y0(dynres_view[23:16]),
+        .dr_w(dynres_size[8:0]),
+        .dr_h(dynres_size[31:24]),
+        .dr_srcw(dynres_size[17:9]),
+        .dr_step_x(dynres_step[15:0]),
+        .dr_step_y(dynres_step[31:16]),
         // SDRAM clock domain (100 MHz)
         .clk_sdram(clk_ram_controller),
         // SDRAM burst read interface
@@ -2510,8 +2543,9 @@ link_mmio #(
 
 //
 // Audio output (FIFO + I2S)
-// HW CD audio resampler — CPU pushes raw samples via MMIO,
-// resampler handles 44100→48000 Hz interpolation + volume + mixing
+// HW CD audio resampler — fetches raw samples from the SDRAM ring the
+// bridge DMAs into (or takes MMIO pushes), handles 44100→48000 Hz
+// interpolation + volume + mixing
 //
 audio_cd_resampler cd_resamp (
     .clk             (clk_cpu),
@@ -2524,7 +2558,15 @@ audio_cd_resampler cd_resamp (
     .reg_wr          (music_reg_wr),
     .reg_addr        (music_reg_addr),
     .reg_wdata       (music_reg_wdata),
-    .reg_rdata       (music_reg_rdata)
+    .reg_rdata       (music_reg_rdata),
+
+    .m_axi_arvalid   (music_m_arvalid),
+    .m_axi_arready   (music_m_arready),
+    .m_axi_araddr    (music_m_araddr),
+    .m_axi_arlen     (music_m_arlen),
+    .m_axi_rvalid    (music_m_rvalid),
+    .m_axi_rdata     (music_m_rdata),
+    .m_axi_rlast     (music_m_rlast)
 );
 
 // HW audio mixer: SFX (from CPU) + CD music (from HW resampler) → clamp → FIFO
@@ -92,7 +92,13 @@ module cpu_system (
     input  wire [1:0]  m_local_bresp,
 
     // Timer interrupt from axi_periph_slave (mtimecmp comparator)
-    input  wire        timer_irq
+    input  wire        timer_irq,
+
+    // Cache refill counters (free-running, to axi_periph_slave PERF_* regs)
+    output reg  [31:0] perf_icache_miss,
+    output reg  [31:0] perf_dcache_miss,
+    output reg  [31:0] perf_icache_stall,
+    output reg  [31:0] perf_dcache_stall
 );
 
 // ============================================
@@ -736,4 +742,31 @@ always @(posedge clk or posedge reset) begin
     end
 end
 
+// ============================================
+// Cache refill counters
+// Misses count AR handshakes.  Stalls count every cycle a bus has a request
+// waiting for the arbiter or in flight, so they include next-line prefetch
+// and (for the D-cache) write-back traffic.
+// ============================================
+wire fetch_bus_busy = fetch_ar_valid | (active_bus == BUS_FETCH && fsm_state != FSM_IDLE);
+wire lsu_bus_busy = lsu_ar_valid | lsu_aw_valid | (active_bus == BUS_LSU && fsm_state != FSM_IDLE);
+
+always @(posedge clk or posedge reset) begin
+    if (reset) begin
+        perf_icache_miss <= 0;
+        perf_dcache_miss <= 0;
+        perf_icache_stall <= 0;
+        perf_dcache_stall <= 0;
+    end else begin
+        if (fetch_ar_valid && fetch_ar_ready)
+            perf_icache_miss <= perf_icache_miss + 1;
+        if (lsu_ar_valid && lsu_ar_ready)
+            perf_dcache_miss <= perf_dcache_miss + 1;
+        if (fetch_bus_busy)
+            perf_icache_stall <= perf_icache_stall + 1;
+        if (lsu_bus_busy)
+            perf_dcache_stall <= perf_dcache_stall + 1;
+    end
+end
+
 endmodule
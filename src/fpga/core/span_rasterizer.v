@@ -26,6 +26,12 @@
 //   0x50: SURF_TEX_STEP   (RW) - Surface block: texture row stride (bytes)
 //   0x54: SURF_DEST_STEP  (RW) - Surface block: dest row stride (bytes)
 //   0x58: SURF_CONTROL    (W)  - Write blockdivshift to enqueue surface block
+//   0xE4: SURF_DMA_BASE   (RW) - Block descriptor list SDRAM byte address (16B aligned);
+//                                writing it rewinds the walker (only while idle)
+//   0xE8: SURF_DMA_KICK   (W)  - Append [15:0] descriptors to the walk
+//         SURF_DMA_STATUS (R)  - {active[16], remaining[15:0]}
+//   0xEC: SURF_DMA_CTRL   (RW) - Sticky: [2:0] blockdivshift for all descriptors
+//   Block descriptor (4 words): dest, src, {light_tr, light_tl}, {light_br, light_bl}
 //   0x90: ALIAS_PTEX      (RW) - Per-span: absolute SDRAM byte address of texture start
 //   0x94: ALIAS_STSTEP    (RW) - Sticky: a_ststepxwhole (signed, combined whole s+t step)
 //   0x98: ALIAS_SFRAC     (RW) - Sticky: {skinwidth[15:0], a_sstepxfrac[15:0]} packed
@@ -181,6 +187,14 @@ reg [15:0] dma_remaining;   // Descriptors remaining to fetch
 reg [25:0] dma_fetch_addr;  // Next SDRAM byte address to fetch (bits [25:0])
 reg [31:0] dma_descriptor;  // Fetched descriptor word
 
+// Surface block descriptor list registers (slots 57-59)
+reg [2:0]  sdma_shift_reg;  // Sticky: blockdivshift for all block descriptors
+reg        sdma_active;     // Walking the block descriptor list
+reg [15:0] sdma_remaining;  // Descriptors kicked but not yet fetched
+reg [25:0] sdma_fetch_addr; // Next descriptor SDRAM byte address (bits [25:0])
+reg [1:0]  sdma_beat;       // Descriptor word being received
+reg [31:0] sdma_dest, sdma_src, sdma_light_t, sdma_light_b;
+
 // Active textured command state
 reg [31:0] cur_fb;
 reg [31:0] cur_tex_addr;
@@ -235,6 +249,8 @@ reg        z_cache_hit_r;
 // Surface block active state
 reg        surf_block_active;
 reg [31:0] surf_ll, surf_lr;
+reg [31:0] surf_bl, surf_br;         // Bottom corners, latched at launch (the
+                                     // CPU may already be writing the next block)
 reg signed [31:0] surf_lls, surf_lrs;
 reg [31:0] surf_tex_step, surf_dest_step;
 reg [4:0]  surf_rows_remaining;
@@ -606,12 +622,15 @@ localparam ST_UV_MAD         = 6'd42;  // UV MAD: compute sdivz/tdivz/zi from or
 localparam ST_DMA_FETCH      = 6'd43;  // DMA: issue AXI read for next descriptor
 localparam ST_DMA_FILL       = 6'd44;  // DMA: wait for AXI read data
 localparam ST_DMA_DISPATCH   = 6'd45;  // DMA: inject descriptor as span command
+localparam ST_SDMA_FETCH     = 6'd46;  // Surface DMA: issue 4-beat read for next block descriptor
+localparam ST_SDMA_FILL      = 6'd47;  // Surface DMA: receive descriptor words
+localparam ST_SDMA_DISPATCH  = 6'd48;  // Surface DMA: launch or enqueue the block
 reg [5:0] state;
 reg       cmd_issued;      // Used for SRAM z-write path
 reg       seen_busy;       // Used for SRAM z-write path
 reg       fb_wr_launched;  // AXI4 write AW+W asserted, waiting for acceptance
 
-wire busy_status = (state != ST_IDLE) || (fifo_count > 2'd0) || dma_active;
+wire busy_status = (state != ST_IDLE) || (fifo_count > 2'd0) || dma_active || sdma_active;
 wire queue_full  = (fifo_count == 2'd2);
 wire can_accept  = (fifo_count < 2'd2);
 assign active = busy_status;
@@ -852,6 +871,9 @@ always @(*) begin
         6'd54: reg_rdata = dma_base_reg;
         6'd55: reg_rdata = {15'd0, dma_active, dma_remaining};
         6'd56: reg_rdata = dma_ctrl_reg;
+        6'd57: reg_rdata = {6'd0, sdma_fetch_addr};
+        6'd58: reg_rdata = {15'd0, sdma_active, sdma_remaining};
+        6'd59: reg_rdata = {29'd0, sdma_shift_reg};
         default: reg_rdata = 32'd0;
     endcase
 end
@@ -924,6 +946,8 @@ always @(posedge clk or negedge reset_n) begin
         surf_block_active <= 1'b0;
         surf_ll           <= 32'd0;
         surf_lr           <= 32'd0;
+        surf_bl           <= 32'd0;
+        surf_br           <= 32'd0;
         surf_lls          <= 32'sd0;
         surf_lrs          <= 32'sd0;
         surf_tex_step     <= 32'd0;
@@ -1000,6 +1024,15 @@ always @(posedge clk or negedge reset_n) begin
         dma_remaining          <= 16'd0;
         dma_fetch_addr         <= 26'd0;
         dma_descriptor         <= 32'd0;
+        sdma_shift_reg         <= 3'd0;
+        sdma_active            <= 1'b0;
+        sdma_remaining         <= 16'd0;
+        sdma_fetch_addr        <= 26'd0;
+        sdma_beat              <= 2'd0;
+        sdma_dest              <= 32'd0;
+        sdma_src               <= 32'd0;
+        sdma_light_t           <= 32'd0;
+        sdma_light_b           <= 32'd0;
         cur_uv_mode            <= 1'b0;
         uv_mad_phase           <= 5'd0;
         uv_sdivz_accum         <= 48'sd0;
@@ -1065,6 +1098,9 @@ always @(posedge clk or negedge reset_n) begin
     end else begin : main_logic
         // Blocking flags for simultaneous FIFO enqueue/dequeue handling
         reg did_enqueue, did_dequeue;
+        // Blocking flags for simultaneous block descriptor kick/fetch
+        reg [15:0] sdma_kick;
+        reg        sdma_took;
 
         // AXI4 valid/ready handshake: deassert valid when ready fires
         if (m_axi_arvalid && m_axi_arready) begin
@@ -1091,6 +1127,8 @@ always @(posedge clk or negedge reset_n) begin
 
         did_enqueue = 1'b0;
         did_dequeue = 1'b0;
+        sdma_kick = 16'd0;
+        sdma_took = 1'b0;
 
         // Clear pf_just_finished each cycle (one-cycle flag)
         pf_just_finished <= 1'b0;
@@ -1318,6 +1356,8 @@ always @(posedge clk or negedge reset_n) begin
                         surf_tex_base   <= tex_addr_reg;
                         surf_ll         <= surf_light_tl_reg;
                         surf_lr         <= surf_light_tr_reg;
+                        surf_bl         <= surf_light_bl_reg;
+                        surf_br         <= surf_light_br_reg;
                         surf_blockshift <= reg_wdata[2:0];
                         surf_tex_step   <= surf_tex_step_reg;
                         surf_dest_step  <= surf_dest_step_reg;
@@ -1387,6 +1427,9 @@ always @(posedge clk or negedge reset_n) begin
                     end
                 end
                 6'd56: dma_ctrl_reg           <= reg_wdata;
+                6'd57: sdma_fetch_addr        <= {reg_wdata[25:4], 4'd0};
+                6'd58: sdma_kick               = reg_wdata[15:0];
+                6'd59: sdma_shift_reg         <= reg_wdata[2:0];
 
                 default: ;
             endcase
@@ -1404,6 +1447,12 @@ always @(posedge clk or negedge reset_n) begin
                 end else if (dma_active && dma_remaining == 16'd0) begin
                     // DMA complete: all descriptors dispatched and processed
                     dma_active <= 1'b0;
+                end else if (sdma_active && sdma_remaining > 16'd0) begin
+                    // Surface DMA: fetch next block descriptor
+                    state <= ST_SDMA_FETCH;
+                end else if (sdma_active) begin
+                    // Surface DMA drained; a kick this cycle re-arms it below
+                    sdma_active <= 1'b0;
                 end
             end
 
@@ -1905,19 +1954,19 @@ always @(posedge clk or negedge reset_n) begin
             ST_SURF_INIT: begin
                 // Compute per-row light steps from corners
                 surf_lls <= (surf_blockshift == 3'd4) ?
-                    (($signed(surf_light_bl_reg) - $signed(surf_ll)) >>> 4) :
+                    (($signed(surf_bl) - $signed(surf_ll)) >>> 4) :
                     (surf_blockshift == 3'd3) ?
-                    (($signed(surf_light_bl_reg) - $signed(surf_ll)) >>> 3) :
+                    (($signed(surf_bl) - $signed(surf_ll)) >>> 3) :
                     (surf_blockshift == 3'd2) ?
-                    (($signed(surf_light_bl_reg) - $signed(surf_ll)) >>> 2) :
-                    (($signed(surf_light_bl_reg) - $signed(surf_ll)) >>> 1);
+                    (($signed(surf_bl) - $signed(surf_ll)) >>> 2) :
+                    (($signed(surf_bl) - $signed(surf_ll)) >>> 1);
                 surf_lrs <= (surf_blockshift == 3'd4) ?
-                    (($signed(surf_light_br_reg) - $signed(surf_lr)) >>> 4) :
+                    (($signed(surf_br) - $signed(surf_lr)) >>> 4) :
                     (surf_blockshift == 3'd3) ?
-                    (($signed(surf_light_br_reg) - $signed(surf_lr)) >>> 3) :
+                    (($signed(surf_br) - $signed(surf_lr)) >>> 3) :
                     (surf_blockshift == 3'd2) ?
-                    (($signed(surf_light_br_reg) - $signed(surf_lr)) >>> 2) :
-                    (($signed(surf_light_br_reg) - $signed(surf_lr)) >>> 1);
+                    (($signed(surf_br) - $signed(surf_lr)) >>> 2) :
+                    (($signed(surf_br) - $signed(surf_lr)) >>> 1);
                 surf_rows_remaining <= surf_blocksize[4:0];
                 state <= ST_SURF_ROW_SETUP;
             end
@@ -2391,8 +2440,8 @@ always @(posedge clk or negedge reset_n) begin
                     surf_tex_base  <= fifo_tex_addr[fifo_rd_ptr];
                     surf_ll        <= fifo_surf_light_tl[fifo_rd_ptr];
                     surf_lr        <= fifo_surf_light_tr[fifo_rd_ptr];
-                    surf_light_bl_reg <= fifo_surf_light_bl[fifo_rd_ptr];
-                    surf_light_br_reg <= fifo_surf_light_br[fifo_rd_ptr];
+                    surf_bl        <= fifo_surf_light_bl[fifo_rd_ptr];
+                    surf_br        <= fifo_surf_light_br[fifo_rd_ptr];
                     surf_blockshift <= fifo_surf_blockshift[fifo_rd_ptr];
                     surf_tex_step  <= fifo_surf_tex_step[fifo_rd_ptr];
                     surf_dest_step <= fifo_surf_dest_step[fifo_rd_ptr];
@@ -2702,11 +2751,81 @@ always @(posedge clk or negedge reset_n) begin
                     // else: FIFO full, stay in ST_DMA_DISPATCH (wait for space)
             end
 
+            // Surface block descriptor list: one 4-beat read per block
+            ST_SDMA_FETCH: begin
+                if (!m_axi_arvalid && !pf_filling && !pf_rd_pending) begin
+                    m_axi_arvalid  <= 1'b1;
+                    m_axi_araddr   <= {6'b0, sdma_fetch_addr[25:4], 4'b0000};
+                    m_axi_arlen    <= 8'd3;
+                    sdma_beat      <= 2'd0;
+                    state          <= ST_SDMA_FILL;
+                end
+            end
+
+            ST_SDMA_FILL: begin
+                if (m_axi_rvalid) begin
+                    case (sdma_beat)
+                        2'd0: sdma_dest    <= m_axi_rdata;
+                        2'd1: sdma_src     <= m_axi_rdata;
+                        2'd2: sdma_light_t <= m_axi_rdata;
+                        2'd3: sdma_light_b <= m_axi_rdata;
+                    endcase
+                    sdma_beat <= sdma_beat + 2'd1;
+                    if (m_axi_rlast) begin
+                        sdma_fetch_addr <= sdma_fetch_addr + 26'd16;
+                        sdma_took = 1'b1;
+                        state <= ST_SDMA_DISPATCH;
+                    end
+                end
+            end
+
+            ST_SDMA_DISPATCH: begin
+                // Same as a SURF_CONTROL write, with the corners unpacked
+                // from the descriptor and the sticky strides/shift
+                if (fifo_count == 2'd0) begin
+                    surf_fb_base    <= sdma_dest;
+                    surf_tex_base   <= sdma_src;
+                    surf_ll         <= {16'd0, sdma_light_t[15:0]};
+                    surf_lr         <= {16'd0, sdma_light_t[31:16]};
+                    surf_bl         <= {16'd0, sdma_light_b[15:0]};
+                    surf_br         <= {16'd0, sdma_light_b[31:16]};
+                    surf_blockshift <= sdma_shift_reg;
+                    surf_tex_step   <= surf_tex_step_reg;
+                    surf_dest_step  <= surf_dest_step_reg;
+                    surf_block_active <= 1'b1;
+                    cmd_issued      <= 1'b0;
+                    seen_busy       <= 1'b0;
+                    state           <= ST_SURF_INIT;
+                end else if (fifo_count < 2'd2) begin
+                    fifo_is_z[fifo_wr_ptr]             <= 1'b0;
+                    fifo_is_surf[fifo_wr_ptr]          <= 1'b1;
+                    fifo_fb[fifo_wr_ptr]               <= sdma_dest;
+                    fifo_tex_addr[fifo_wr_ptr]         <= sdma_src;
+                    fifo_surf_light_tl[fifo_wr_ptr]    <= {16'd0, sdma_light_t[15:0]};
+                    fifo_surf_light_tr[fifo_wr_ptr]    <= {16'd0, sdma_light_t[31:16]};
+                    fifo_surf_light_bl[fifo_wr_ptr]    <= {16'd0, sdma_light_b[15:0]};
+                    fifo_surf_light_br[fifo_wr_ptr]    <= {16'd0, sdma_light_b[31:16]};
+                    fifo_surf_tex_step[fifo_wr_ptr]    <= surf_tex_step_reg;
+                    fifo_surf_dest_step[fifo_wr_ptr]   <= surf_dest_step_reg;
+                    fifo_surf_blockshift[fifo_wr_ptr]  <= sdma_shift_reg;
+                    fifo_wr_ptr <= ~fifo_wr_ptr;
+                    did_enqueue = 1'b1;
+                    state <= ST_IDLE;
+                end
+                // else: FIFO full, stay in ST_SDMA_DISPATCH (wait for space)
+            end
+
             default: begin
                 state <= ST_IDLE;
             end
         endcase
 
+        // Single-point block descriptor count update (kick appends, fetch consumes)
+        if (sdma_kick != 16'd0 || sdma_took)
+            sdma_remaining <= sdma_remaining + sdma_kick - {15'd0, sdma_took};
+        if (sdma_kick != 16'd0)
+            sdma_active <= 1'b1;
+
         // Single-point FIFO count update (handles simultaneous enqueue+dequeue)
         case ({did_enqueue, did_dequeue})
             2'b10: fifo_count <= fifo_count + 2'd1;
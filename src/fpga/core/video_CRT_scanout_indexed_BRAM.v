@@ -2,6 +2,15 @@
 // Video Scanout with 8-bit Indexed Color and Hardware Palette
 // Reads 8-bit palette indices from SDRAM, looks up RGB565 in palette RAM
 //
+// Dynamic resolution: when dr_enable is set, the output window
+// (dr_x0, dr_y0, dr_w, dr_h) is filled by stretching the smaller source
+// rectangle at the same origin.  Source coordinates are
+// origin + (offset * step) >> 16, so steps are source/output in 0.16.
+// Rows map at fetch time; columns map per pixel, either nearest or 2-tap
+// horizontal (dr_filter).  The second tap stops at the last rendered
+// source column (dr_x0 + dr_srcw - 1).  Everything outside the window is
+// scanned 1:1.
+//
 
 `default_nettype none
 
@@ -21,6 +30,17 @@ module video_CRT_scanout_indexed_BRAM (
     // Framebuffer base address (25-bit SDRAM byte address >> 1 = 16-bit word address)
     input wire [24:0] fb_base_addr,
 
+    // Dynamic resolution window (changes only at vsync, no CDC needed)
+    input wire        dr_enable,
+    input wire        dr_filter,
+    input wire [8:0]  dr_x0,
+    input wire [7:0]  dr_y0,
+    input wire [8:0]  dr_w,
+    input wire [7:0]  dr_h,
+    input wire [8:0]  dr_srcw,
+    input wire [15:0] dr_step_x,
+    input wire [15:0] dr_step_y,
+
     // SDRAM clock domain (66 MHz)
     input wire clk_sdram,
 
@@ -53,11 +73,13 @@ module video_CRT_scanout_indexed_BRAM (
     // Store as 16-bit words for efficient SDRAM reads
     reg [31:0] line_buffer [0:79];  // 80 x 32-bit = 320 x 8-bit indices
     reg [31:0] bram_rd_data;
+    reg [31:0] bram_rd_data_b;      // second tap (next source pixel)
     reg [7:0] write_ptr;    // Write pointer (0-159 for 16-bit words)
 
     // Palette RAM: 256 entries x 24-bit RGB
     // Using inferred dual-port RAM
     reg [23:0] palette [0:255];
+    reg [23:0] palette_b [0:255];   // copy for the second filter tap
 
     // Use 32-bit burst mode (4 pixels per 32-bit word)
     assign burst_32bit = 1'b1;
@@ -68,6 +90,7 @@ module video_CRT_scanout_indexed_BRAM (
     always @(posedge clk_sdram) begin
         if (pal_wr) begin
             palette[pal_addr] <= pal_data;
+            palette_b[pal_addr] <= pal_data;
         end
     end
 
@@ -79,6 +102,14 @@ module video_CRT_scanout_indexed_BRAM (
     wire [9:0] fetch_line = y_count - VID_V_SYNC - VID_V_BPORCH + 1;  // Fetch line ahead
     wire in_vactive = (y_count >= (VID_V_SYNC + VID_V_BPORCH - 1)) && (y_count < (VID_V_SYNC + VID_V_BPORCH + VID_V_ACTIVE - 1));
 
+    // Rows inside the window fetch y0 + ((line - y0) * step_y) >> 16
+    wire [9:0]  dr_fetch_rel  = fetch_line - {2'b0, dr_y0};
+    wire        dr_fetch_in   = dr_enable && (fetch_line >= {2'b0, dr_y0}) &&
+                                (dr_fetch_rel < {2'b0, dr_h});
+    wire [24:0] dr_fetch_prod = dr_fetch_rel[8:0] * dr_step_y;
+    wire [9:0]  fetch_src_line = dr_fetch_in ? ({2'b0, dr_y0} + {1'b0, dr_fetch_prod[24:16]})
+                                             : fetch_line;
+
     // Generate fetch request at end of line (before next visible line)
     reg fetch_request;
     reg fetch_request_ack_sync1, fetch_request_ack_sync2;
@@ -103,7 +134,7 @@ module video_CRT_scanout_indexed_BRAM (
             // Issue fetch request at line start if in active region
             if (line_start && in_vactive && !fetch_request) begin
                 fetch_request <= 1;
-                fetch_line_latched <= fetch_line[9:0];
+                fetch_line_latched <= fetch_src_line[8:0];
             end
         end
     end
@@ -116,38 +147,91 @@ module video_CRT_scanout_indexed_BRAM (
     wire in_hactive = (x_count >= (VID_H_SYNC + VID_H_BPORCH)) && (x_count < (VID_H_SYNC + VID_H_BPORCH + VID_H_ACTIVE));
     wire in_vactive_display = (y_count >= (VID_V_SYNC + VID_V_BPORCH)) && (y_count < (VID_V_SYNC + VID_V_BPORCH + VID_V_ACTIVE));
 
+    // Columns inside the window read x0 + ((x - x0) * step_x) >> 16
+    wire [9:0]  disp_line  = y_count - VID_V_SYNC - VID_V_BPORCH;
+    wire [9:0]  dr_line_rel = disp_line - {2'b0, dr_y0};
+    wire        dr_line_in = dr_enable && (disp_line >= {2'b0, dr_y0}) &&
+                             (dr_line_rel < {2'b0, dr_h});
+    wire [8:0]  out_px     = visible_x[9:1];
+    wire [8:0]  dr_rel_x   = out_px - dr_x0;
+    wire        dr_px_in   = dr_line_in && (out_px >= dr_x0) && (dr_rel_x < dr_w);
+    wire [24:0] dr_x_prod  = dr_rel_x * dr_step_x;
+    wire [8:0]  src_px     = dr_px_in ? (dr_x0 + dr_x_prod[24:16]) : out_px;
+    wire [8:0]  dr_src_last = dr_x0 + dr_srcw - 9'd1;
+    wire        dr_tap     = dr_px_in && dr_filter && (src_px < dr_src_last);
+    wire [8:0]  src_px_b   = dr_tap ? (src_px + 9'd1) : src_px;
+    wire [1:0]  tap_weight = dr_tap ? dr_x_prod[15:14] : 2'd0;
+
     // Pipeline para compensar latencia de BRAM (2 ciclos)
-    reg [1:0] sub_pixel_q;
+    // Stays 3 stages deep, as core_top expects: the byte select feeds the
+    // palette read directly, which leaves stage 3 free for the blend.
+    reg [1:0] sub_pixel_q, sub_pixel_b_q;
+    reg [1:0] tap_weight_q1, tap_weight_q2;
     reg hactive_q1, hactive_q2;
     reg vactive_q1, vactive_q2;
-    reg [7:0] palette_index;
+    reg [7:0] palette_index, palette_index_b;
+    reg [23:0] color_a, color_b;
+
+    // Selección de Píxel (8-bit) de la palabra leída en la etapa 1
+    always @(*) begin
+        case (sub_pixel_q)
+            2'b00: palette_index = bram_rd_data[7:0];
+            2'b01: palette_index = bram_rd_data[15:8];
+            2'b10: palette_index = bram_rd_data[23:16];
+            2'b11: palette_index = bram_rd_data[31:24];
+        endcase
+        case (sub_pixel_b_q)
+            2'b00: palette_index_b = bram_rd_data_b[7:0];
+            2'b01: palette_index_b = bram_rd_data_b[15:8];
+            2'b10: palette_index_b = bram_rd_data_b[23:16];
+            2'b11: palette_index_b = bram_rd_data_b[31:24];
+        endcase
+    end
+
+    // (a * (4 - w) + b * w) / 4 for one 8-bit channel
+    function [7:0] tap_blend;
+        input [7:0] a, b;
+        input [1:0] w;
+        reg [9:0] sum;
+        begin
+            case (w)
+                2'd0: sum = {a, 2'b00};
+                2'd1: sum = {1'b0, a, 1'b0} + {2'b0, a} + {2'b0, b};
+                2'd2: sum = {1'b0, a, 1'b0} + {1'b0, b, 1'b0};
+                2'd3: sum = {2'b0, a} + {1'b0, b, 1'b0} + {2'b0, b};
+            endcase
+            tap_blend = sum[9:2];
+        end
+    endfunction
 
     always @(posedge clk_video) begin
         // ETAPA 1: Direccionamiento de BRAM
         // Como escalamos 320 píxeles a 640 (H_ACTIVE), dividimos por 2 adicionalmente.
-        // visible_x[9:2] selecciona la palabra de 32 bits (4 píxeles)
-        bram_rd_data <= line_buffer[visible_x[9:3]];
+        // src_px[8:2] selecciona la palabra de 32 bits (4 píxeles)
+        bram_rd_data <= line_buffer[src_px[8:2]];
+        bram_rd_data_b <= line_buffer[src_px_b[8:2]];
         
         // Guardamos los bits bajos para saber qué byte elegir de la palabra
-        sub_pixel_q <= visible_x[2:1]; 
+        sub_pixel_q <= src_px[1:0];
+        sub_pixel_b_q <= src_px_b[1:0];
+        tap_weight_q1 <= tap_weight;
         
         // Retrasamos señales de control
         hactive_q1 <= in_hactive;
         vactive_q1 <= in_vactive_display;
 
-        // ETAPA 2: Selección de Píxel (8-bit)
-        case (sub_pixel_q)
-            2'b00: palette_index <= bram_rd_data[7:0];
-            2'b01: palette_index <= bram_rd_data[15:8];
-            2'b10: palette_index <= bram_rd_data[23:16];
-            2'b11: palette_index <= bram_rd_data[31:24];
-        endcase
+        // ETAPA 2: Lectura de Paleta Síncrona (ambas tomas)
+        color_a <= palette[palette_index];
+        color_b <= palette_b[palette_index_b];
+        tap_weight_q2 <= tap_weight_q1;
         hactive_q2 <= hactive_q1;
         vactive_q2 <= vactive_q1;
 
-        // ETAPA 3: Salida Final (Lectura de Paleta Síncrona)
+        // ETAPA 3: Salida Final (mezcla de 2 tomas)
         if (hactive_q2 && vactive_q2) begin
-            pixel_color <= palette[palette_index];
+            pixel_color <= {tap_blend(color_a[23:16], color_b[23:16], tap_weight_q2),
+                            tap_blend(color_a[15:8],  color_b[15:8],  tap_weight_q2),
+                            tap_blend(color_a[7:0],   color_b[7:0],   tap_weight_q2)};
         end else begin
             pixel_color <= 24'h000000;
         end